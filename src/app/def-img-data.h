@@ -1,271 +1,271 @@
-/*  GIMP header image file format (RGB): C:\EAP\PLH40\PROJECT\upscale\src\app\def-img-data.h  */
-
-static unsigned int width = 64;
-static unsigned int height = 64;
-
-/*  Call this macro repeatedly.  After each use, the pixel data can be extracted  */
-
-#define HEADER_PIXEL(data,pixel) {\
-pixel[0] = (((data[0] - 33) << 2) | ((data[1] - 33) >> 4)); \
-pixel[1] = ((((data[1] - 33) & 0xF) << 4) | ((data[2] - 33) >> 2)); \
-pixel[2] = ((((data[2] - 33) & 0x3) << 6) | ((data[3] - 33))); \
-data += 4; \
-}
-static char *header_data =
-	"````````````````````````````````````````````````````````````````"
-	"```````````````````````````````V_PLN\\?\\4W^[IUN3)Q=>XL\\FRJL2QJ;>A"
-	"M99OOZ1^S[F1X-BP[>[.VMW@X.D(\\P$K^@HV````````````````````````````"
-	"````````````````````````````````````````````````````````````````"
-	"````````````````````````````````````````````````````````````````"
-	"`````P\\]```````````S]?`#S-S@I;JV@9V?;I\"S6H/*2'??1'7J2G_S4F?0:A)6"
-	"=1!!?1!!A!!!BQ!!EQ!!HBQ+C3!(>#%$D&I[MJK#T.<\"]PLT`````````@X]````"
-	"````````````````````````````````````````````````````````````````"
-	"`````````````````````````````````````````````````````````````P\\^"
-	"`0X]`````PTKV./(DZNR7H&H4'BX/&K/.6G;0G+>2'??4'S?5(3F7V6X<Q-#?!!!"
-	"@1)\"B1)\"D1-#F1-#H!)#IQ)#LA1%O!%\"O!%\"K!Y#HRM&IFM]J+O$[`<L`````@P["
-	"`P\\^````````````````````````````````````````````````````````````"
-	"`````````````````````````````````````````````````````````P\\]`P\\`"
-	"```^S=BW=(^2.V6W.&7!-&/+.6C//VW21'+62';:37G=47_C6F&W<!!!=Q!!?A!!"
-	"A1!!C1!!E1!!FQ!!HA!!JA!!L1!!N1!!P!!!R1!!T1!!T11\"T!I$HU!;I;:X`P\\^"
-	"``\\_`@X]````````````````````````````````````````````````````````"
-	"```````````````````````````````````````````````````````````^VN?L"
-	">9!U,5RS*5G&-&'\"-6/&.6?+/FS00G#41G382GC<3G_D6&2Z;!!!<Q1&>Q!!@A!!"
-	"B1!!D!!!F!!!H!!!IQ!!K1!!M1!!O1!!Q!!!S!!!TQ!!V1%!WQ)\"\\!1%Y1E$EUQ6"
-	"TM?K`@`_````````````````````````````````````````````````````````"
-	"`````````````````````````````````````````````@X\\````]P$5FZZ>2&N5"
-	"'4[%+EN],5^`,V'%-V7)/&K.0&[21'+62';:3'_E56?!:A!!<!1&=Q!!?Q!!AA!!"
-	"CA!!E1!!G!!!I!!!JQ!!LA!!NA!!P1!!R!!!T!!!UQ!!WA!!YA!!ZQ)!\\Q-#`Q5&"
-	"T31+LY*2YO\\;`````@X]````````````````````````````````````````````"
-	"````````````````````````````````````````_`PX````V./58'R)*%2L(E&^"
-	"*EBY+5N_,F#$-F3(.FC,/FS00W'51W792GK>47'/9!M1;1!!=1!!?!!!@Q!!BQ!!"
-	"D1!!F1!!H1!!J!!!KQ!!MQ!!OA!!Q1!!S1!!U!!!W!!!XQ!!ZA!!\\1!!^1!!_A%!"
-	"`Q-$\\QA$O5A@Q=_E````_`PY````````````````````````````````````````"
-	"`````````````````````````````````````@X]````N<6B.5Z4'TVQ(U&W*%:Y"
-	"*UF],%[\"-&+&.6?+/&K.06_317/72G;:3GC;7C!P:Q!!<A!!>!!!@!!!B!!!CQ!!"
-	"EA!!GA!!I1!!K!!!LQ!!NQ!!PA!!RA!!T1!!V!!!WQ!!YQ!![A!!]A!!_A!!`A!!"
-	"_Q!!_!%\"]A!!TS1.L<.X`````PX]````````````````````````````````````"
-	"```````````````````````````````````````^I[27*5*<'TVO(U\"R)E2X*EB\\"
-	"+ER`,F#$-F3(.VG-/VW10W'51W373'O@5E*B:!!!;A)#=A!!?1!!A1!!C!!!DQ!!"
-	"FA!!HA!!J1!!L1!!N!!!OA!!QA!!SA!!U1!!W1!!Y!!!ZQ!!\\A!!^A!!`1!!`!!!"
-	"_!!!^!!!\\A%![A)#VR5(LK.G`P`_````````````````````````````````````"
-	"`````````````````````````````@X]```^I+.>*5*9&TJP($ZQ)%*V)U6Y+%J^"
-	",%[\"-6/'.6?+/6O/06_31G382G;:3W359!!!:Q-&<Q!!>A!!@1!!B!%!CQ%\"EA!\""
-	"G1!!I1%\"K1%!M!!!O!!!PQ!!RQ!!TA!!V1!!X!!!Z!!![Q!!]Q!!_A!!`A!!_A!!"
-	"^A!!]1!!\\1!!ZQ%!ZA)#U\"=)NK\"G`@`_`P\\]````````````````````````````"
-	"`````````````````````````0TX````K+J;*%&8%T6R'DRO(E\"T)U2X*EB\\+UW!"
-	",V'%-V7).VG-0&[21'+627792X3L72]N:!!!;Q%\"=Q!!?A!!AA)\"C!!#FA!!J\"1!"
-	"L29!LA!!LQ!\"N!)\"P!!!QQ!!SQ!!UA!!WA!!Y1!![!!!]!!!^Q!!`1!!`!!!^Q!!"
-	"]Q!!\\A!![A!!Z1!!Y1%!Y!-$SBA)N;JK````_`TY````````````````````````"
-	"`````````````````````@X\\````P<RH)DZ8&$:M'$JM($ZR)%*V*5>[+5N_,5_#"
-	"-6/'.FC,/FS00G#41G382GO@4F?!9!1';!%#=!!!>Q!!@Q)!B1!!C#E$:VYY;G^J"
-	";G^L4%%UHC1+O1!!Q!)!S!!!TQ!!VQ!!XA!!Z1!!\\!!!^!!!_Q!!`1!!_1!!^1!!"
-	"]1!!\\!!!ZQ!!YQ!!XA!!W1%!VQ)#RB=)OL^^`````@X]````````````````````"
-	"````````````````````````WNG7-EJ/&$:I&TFL'DRP(U&U)U6Y*UF]+UW!-&+&"
-	"-V7)/&K.0&[217/727;:2X/J7#V#:A!!<1!!=Q!!?Q)\"AA!!BEM?272S:XC>=9+B"
-	"=9+B;HK>0W*VH5=CRA!!SQ)\"UQ!!WQ!!YA!![A!!]1!!_!!!`A!!_Q!!^Q!!]A!!"
-	"\\1!![1!!Z1!!Y!!!WQ!!VQ!!UA%!TA)#P3I0U.WK````````````````````````"
-	"````````````````````^0057WN'%$*F&D>I'4NO(4^S)5.W*5>[+5N_,F#$-F3("
-	".FC,/FS00W'51W792WK?4'758R5?;A!!=1!!?1%!?Q!!G5!6/FRM5G/,88;99XSC"
-	"9XSC8(79673,.6NNRTY9TA!!W!%\"XQ!!ZA!!\\1!!^1!!`1!!`1!!_1!!^!!!]!!!"
-	"[Q!!ZQ!!YA!!XA!!W1!!V1!!U!!!SQ)\"RQ!!MVAH\\@<?````````````````````"
-	"`````````````P\\]```^GK\"@&T>?%D6K&DBM'TVQ(U&U*%:Z+%J^,%[\"-&+&.6?+"
-	"/6O/06_317/72GC<37[C5F:^:A1'<A!!>1!!@!%\"BA!!?H2-,56W4'?/7HCE:93T"
-	":93T7HCE4'?/,U6WAX2-X1!!WA%\"YQ!![Q!!]A!!_1!!`A!!_A!!^A!!]1!!\\1!!"
-	"[!!!Z!!!XQ!!WQ!!VA!!UA!!T1!!S1!!R1%\"P!M%P:J?`P`_`P\\^````````````"
-	"`````````P\\^`P\\`W.GN/V*+$#^L&D>K'4NO(4^S)E2X*EB\\+ER`,F#$-V7).VG-"
-	"/VW10W'52';:2WG=4('G6URO<!!!=A!!?1!!@A!!HRY%56R</F&\\5'W8:)3S>ZD+"
-	">ZD+:)3S5'W8/V&\\66R=[RY&XA!![!!!\\A!!^A!!`A!!`1!!_!!!^!!!\\Q!![Q!!"
-	"ZA!!Y1!!X1!!W1!!V!!!TQ!!SQ!!RQ!!QA!!Q!-$LT13XNGU``\\_`P\\^````````"
-	"`````````0T\\```^>8]T\"3BP&4>H'$JN'TVQ)%*V*%:Z+5N_,5_#-6/'.6?+/6O/"
-	"0G#41G382GC<3GS?4H+G8%\"?=1!!>Q!!@1!!A1!!IR]%5&N</F.]5'[8:)3S?*H,"
-	"?*H,:)3S5'[8/V.]66N=\\R]&YA!!\\!!!]Q!!_Q!!`1!!_A!!^1!!]1!!\\!!![!!!"
-	"YQ!!XQ!!WA!!VA!!U1!!T1!!S!!!QQ!!PQ!!OA)\"O15&K(5J```_`@T\\````````"
-	"`````P\\]````T=V['$>>&4:H&DBL'DRP(E\"T)E2X*UF]+ER`,V'%-V7)/&K./VW1"
-	"1'+62';:37O?4'[B583I9$Z9>1!!?A!!AA!!C!%\"F1!!?X2-,E2V3W?.78?E:)3S"
-	":)3S78?E3W?.-%2VAX./[Q!!ZQ%\"]!!!^Q!!`A!!`!!!_!!!]Q!!\\A!![A!!Z1!!"
-	"Y1!!X!!!W!!!UQ!!TQ!!SA!!RA!!Q1!!P1!!O!!!N1-#L1U&T.#-`````P\\^````"
-	"``````````\\K;(:(#SZL&DBH'$JN($ZR)5.W*5>[+5N_,5_#-F3(.FC,/FS00G#4"
-	"1W792WG=3WWA4X'D5X?L9U.@?A!!@Q!!BA!!DA%\"E!!!K5%7-V>J/UZ\\3G;.5'W9"
-	"5'W9377.05Z[,F:LV5!9YQ!!\\!%\"^!!!`!!!`A!!_1!!^!!!]!!!\\!!!ZQ!!YA!!"
-	"XA!!W1!!V1!!U!!!T!!!RQ!!QQ!!PA!!OA!!N1!!M1-\"LA1%KW9L_@`R````````"
-	"````````V^7*(DR=&4>H&DBL'TVQ(E\"T)U6Y*UF],%[\",V'%.&;*/&K.06_31'+6"
-	"27?;37O?47_C58/G68SQ9F&U@A!!AQ!!CA!!EA!!G1)\"I!!!F5Y@,6*G-EBY/V.]"
-	"0&.].5NX+&&IKEEFYQ!![!)\"]A!!_!!!`A!!_Q!!^Q!!]A!!\\A!![1!!Z!!!Y!!!"
-	"X!!!VQ!!UA!!TA!!SA!!R1!!Q!!!P!!!NQ!!MQ!!LA!!KA-#JB)(V.G;````````"
-	"```````SB*&G&D>C&D>J'4NO(4^S)5.W*EB\\+ER`,F#$-F3(.VG-/VW10W'51W79"
-	"3'K>3WWA5(+F6(;J7(WR9W'*@Q5)C!!!DA!!FA!!H1!!J1)!L!!!ISU&:&EX4&.6"
-	"3V*94$UTO3A-Y1!!ZA)!\\A!!^1!!`1!!`1!!_!!!^!!!\\Q!![Q!!ZA!!YA!!X1!!"
-	"W1!!V!!!U!!!SQ!!RA!!QA!!PA!!O1!!N!!!M!!!L!!!JQ%!IA=$O9.1`@`Y````"
-	"````]P$%1VJ1$T*J&TFM'TVQ)%*V)U6Y+%J^,%[\"-6/'.&;*/6O/06_317/727?;"
-	"3GS@4H#D5H3H6HCL7X[R9(SN@BMFD!!!EQ!!GA!!IA!!K!!!LQ)\"NQ!\"S!!!V2M!"
-	"X2U$XA!!XA!!YA)\"[Q!!]A!!_A!!`A!!_Q!!^A!!]1!!\\1!![1!!Z!!!XQ!!WQ!!"
-	"VA!!UA!!T1!!S1!!R!!!Q!!!OQ!!NQ!!MA!!LA!!K1!!J1!!HQ!!IDM6\\042````"
-	"````Q];;,UJ;%D6L'DRP(4^S)E2X*EB\\+UW!,F#$-V7).VG-0&[20W'52';:3'K>"
-	"47_C5(+F68?K78OO8I#T8YT$?%*<E!%\"FQ!\"HA!!JA!!L1!!N!!!OQ%!Q1%\"S!!!"
-	"U!!!W!%\"Y!%![!!!\\A!!^A!!`1!!`!!!_!!!]Q!!\\Q!![A!!Z1!!Y1!!X1!!W!!!"
-	"UQ!!TQ!!SA!!RA!!Q1!!P1!!O!!!N!!!LQ!!KQ!!JA!!IA!!H1!!H3)-V-/7````"
-	"```VEZRH%D2J&TFN($ZR)%*V*%:Z+%J^,5_#-6/'.6?+/6O/0G#41G382GC<3GS@"
-	"4X'E5X7I6XGM7XWQ8Y'U:);[;9C[E1I/GQ-%IQ!!KQ!!M1!!O!!!Q!!!RQ!!TQ!!"
-	"V1!!X1!!Z!!!\\!!!]Q!!_Q!!`A!!_A!!^1!!]1!!\\!!![!!!YQ!!XQ!!WA!!VA!!"
-	"U1!!T1!!S!!!R!!!PQ!!OQ!!NA!!MA!!L1!!K!!!J!!!I!!!GQ!!F1!!OJ*7`@`Z"
-	"_PHN:(2'#T\"Q'DRP(U&U)E2X*UF]+UW!-&+&-V7)/&K.0&[217/72';:37O?47_C"
-	"58/G68?K7HSP8I#T9I3X:Y?[;:$&@FZ`I!!!JA)$LA!!NA!!P1!!QQ!!SQ!!UQ!!"
-	"WA!!YA!![1!!]!!!^Q!!`A!!`!!!^Q!!]A!!\\A!![1!!Z1!!Y!!!X!!!VQ!!UQ!!"
-	"TA!!SA!!R1!!Q1!!P!!!O!!!MQ!!LQ!!KA!!JA!!I1!!H!!!G!!!E1%\"IF]B_@LQ"
-	"[?L03W&3&$>T($ZR)5.W*5>[+5N_,5_#-F3(.FC,/FS00G#41G382WG=3WWA4X'E"
-	"5X7I7(KN8([R9)+V:);Z;9O_<IS_<ZP2EDN0LA!!M1)$OA!!Q1!!S!!!U!!!W!!!"
-	"XA!!ZA!!\\1!!^!!!`!!!`A!!_!!!^1!!]!!!\\!!!ZQ!!YQ!!XA!!W1!!V1!!U1!!"
-	"T!!!RQ!!QQ!!PA!!OA!!N1!!M1!!L!!!K!!!IQ!!HQ!!GA!!FA!!E11%G5!7\\OL2"
-	"UN7B,ENB'4RS(U&U)U6Y*UF],%[\"-&+&.&;*/&K.06_317/727?;37O?4H#D5H3H"
-	"6HCL7HSP8Y'U9Y7Y:YG];YX!<Z,&>:0'?*L-I3Y^O1!!PA%#R1!!T1!!V!!!WQ!!"
-	"YQ!![A!!]A!!_1!!`A!!_Q!!^A!!]A!!\\1!![1!!Z!!!Y!!!WQ!!VQ!!UA!!T1!!"
-	"S1!!R1!!Q!!!OQ!!NQ!!MQ!!LA!!K1!!J1!!I!!!H!!!FQ!!EQ!!DA)#DRY+X.3D"
-	"Q]6\\&4BP)%*T)E2W*5>[+ER`,F#$-V7).FC,/VW10W'52';:2WG=4'[B5(+F68?K"
-	"7(KN88_S99/W:9?[;9O_<J$$=J4(>JD,?J\\2A:X/L3EWQA!!S1%\"U1!!W!!!Y!!!"
-	"ZQ!!\\A!!^1!!`1!!`1!!_!!!^!!!]!!![Q!!ZA!!YA!!X1!!W1!!V!!!U!!!SQ!!"
-	"RQ!!QA!!PA!!O1!!N1!!M!!!KQ!!JQ!!IQ!!HA!!G1!!F1!!E!!!D1)#B1!!TM3!"
-	"L,&D$4*V)U2V*%:Z+%J^,%[\"-6/'.6?+/6O/06_31G382GC<3GS@4H#D5H3H6XGM"
-	"7XWQ8Y'U9Y7Y;)K^<)\\\"=*,&>*<*?:P/@:`3AK,6B+P?N4.\"T1%\"V1!!X!!\"Z!!!"
-	"[Q!!]Q!!_A!!`A!!_A!!^A!!]1!!\\1!![!!!Z!!!XQ!!WA!!VA!!UA!!T1!!S!!!"
-	"R!!!Q!!!OQ!!NA!!MA!!L1!!K1!!J!!!I!!!GQ!!FQ!!EA!!D1!!CA-#A!!!PKJ@"
-	"EJR7%D>X*%:X*EB\\+ER`,V'%-V7).VG-/VW11'+61W793'K>4'[B58/G68?K78OO"
-	"88_S9I3X:IC\\;IS`<J$$=Z8)>JD,?ZX1@[(5B+89C;88C,HPM6FSW!9(YQ!!ZQ)#"
-	"\\Q!!^A!!`A!!`!!!_!!!]Q!!\\Q!![A!!ZA!!Y1!!X1!!W!!!V!!!TQ!!SQ!!RA!!"
-	"QA!!P1!!O!!!N!!!M!!!KQ!!JA!!IA!!H1!!G1!!F!!!E!!!CQ!!BQ-#@A!!M*\"'"
-	"AIR,&$F\\*EBZ+5N_,5_#-F3(.6?+/FS00G#41G382GC<3WWA4X'E5X7I6XGM8([R"
-	"9)+V:9?[;)K^<9`#=:0'>:@+?:P/@K$4AK48BKD<CKT@E+\\BD\\`UJJ#XW#1N]1!!"
-	"]15'_Q%\"`A!!_1!!^1!!]1!!\\!!!ZQ!!YQ!!XA!!WA!!V1!!U1!!T!!!S!!!QQ!!"
-	"PQ!!OA!!NA!!M1!!L!!!K!!!J!!!HQ!!GA!!FA!!E1!!D1!!C!!!B1)\"?A!!J(QR"
-	"?I:)&TR_+%J\\+UW!,V'%.&;*/&K.0&[21'+627?;37O?47_C58/G6HCL7HSP8I#T"
-	"9I3X:IC\\;YX!<Z(%=Z8)>ZH-@*\\2A+,6B+<:C+L>D;`CE<0GF<@KG,\\RH\\XPR7[)"
-	"_A!!`1)$_Q)#^Q!!]Q!!\\A!![1!!Z1!!Y1!!X!!!VQ!!UQ!!TA!!SA!!R1!!Q1!!"
-	"P!!!O!!!MQ!!LQ!!KA!!JA!!I1!!H1!!G!!!F!!!DQ!!CQ!!BA!!AQ)\"?!!!HH1I"
-	"@)B*'D_!+UR^,F#$-F3(.FC,/FS00W'51W792WG=3WWA5(+F5X7I7(KN8([R99/W"
-	":);Z;9O_<9`#=J4(>:@+?JT0@K$4A[89BKD<C[XAD\\(EE\\8IG,LNH,\\RIL`RI]@["
-	"L<\\MZD>$_A!!^1!!]!!![Q!!ZQ!!YA!!X1!!W1!!V1!!U!!!SQ!!RQ!!QQ!!PA!!"
-	"O1!!N1!!M!!!L!!!JQ!!IQ!!HA!!GA!!F1!!E1!!D!!!C!!!AQ!!@Q)\">1!!H81I"
-	"B)^.(5'$,5_!-&+&.&;*/6O/06_317/727?;37O?4H#D5H3H6HCL7HSP8Y'U9Y7Y"
-	":YG];YX!=*,&>*<*?*L.@*\\2A;07B;@;C;P?D;`CEL4HF<@KGLTPHM$TIM8YJ]<Z"
-	"K=L^H>(`PH;5[2)8]1!!ZQ-%Z1!!Y!!!WQ!!VQ!!UA!!TA!!S1!!R1!!Q!!!P!!!"
-	"NQ!!MQ!!LA!!KA!!J1!!I1!!H!!!G!!!EQ!!DA!!CA!!B1!!A1!!@1)\"=Q!!I8QR"
-	"F:Z:)%3&-6+#-V7).VG-/VW10W'52';:3'K>4'[B5(+F68?K78OO88_S99/W:IC\\"
-	";IS`<J$$=J4(>JD,?ZX1@[(5A[89B[H=D+\\BE,,FF,<JG,LNH<`SI-,VJ=<ZKMT`"
-	"JM@[H\\\\QE=0ZH*D$TT!_\\1!!XQ-%X1!!W!!!V!!!TQ!!SQ!!RA!!QA!!P1!!O1!!"
-	"N!!!M!!!KQ!!JQ!!IA!!HA!!G1!!F!!!E!!!D!!!BQ!!AA!!@A!!?Q-#=!!!L*\"'"
-	"L\\2G)57)-V7&.6?+/6O/06_31G382GC<3GS@4H#D5X7I6XGM7XWQ8Y'U:);Z:YG]"
-	"<)\\\"=*,&>:@+?*L.@:`3A;07BKD<C;P?DL$DEL4HF\\HMGLTPH](UI]8YK-L^K-L^"
-	"IM4XGLTPEL0GC;\\CBK$2OE&8YQ!!WA!\"VA!!UA!!T1!!S1!!R!!!PQ!!OQ!!NQ!!"
-	"MA!!L1!!K1!!J!!!I!!!GQ!!FQ!!EA!!DA!!C1!!B1!!A!!!@!!!?1-#<!!!O[NB"
-	"R->^+U[&.F;*/&K./VW11'+62';:37O?47_C58/G68?K78OO8I#T9I3X:IC\\;IS`"
-	"<Z(%=Z8)>ZH-?ZX1A+,6B+<:C+L>D+\\BE<0GF,<JG<POH<`SIM4XJ=@[K=P_J-<Z"
-	"H<`SF<@KDL$DBKD<A+$4>*X2M$V4WA!!UQ%\"TQ!!SA!!RA!!Q1!!P1!!O!!!MQ!!"
-	"LQ!!KQ!!JA!!I1!!H1!!G1!!F!!!DQ!!CQ!!BA!!AA!!@1!!?1!!>A)#<1!!T-7\""
-	"V.?D27*X.6?//FS00G#41G382WG=3GS@4X'E5X7I7(KN7XWQ9)+V:);Z;9O_<)\\\""
-	"=:0'>:@+?JT0@:`3AK48BKD<C[XADL$DE\\8IF\\HMG\\XQH](UJ-<ZK-L^K-L^I-,V"
-	"G<POE<0GC;P?AK48?JT0>*0&::4+L$&%V1!!SA)$S!!!QQ!!PQ!!OA!!NA!!M1!!"
-	"L1!!K!!!J!!!HQ!!GQ!!FA!!E1!!D1!!C1!!B!!!@Q!!?Q!!>Q!!=1)#>RY,WN/D"
-	"[OP18X:H.6G50&[217/727?;37O?47_C5H3H6HCL7HSP8I#T9Y7Y:YG];YX!<Z(%"
-	">*<*>ZH-@*\\2A+,6B;@;C+L>D;`CE<0GFLDLG<POHM$TIM4XJMD\\K=P_J-<ZH,\\R"
-	"F,<JD;`CB;@;@:`3>JD,<J$$;)?Z8I+WN\"QIT!!!R1%\"Q!!!P!!!NQ!!MQ!!LA!!"
-	"KA!!J1!!I1!!H!!!G!!!EQ!!DQ!!CA!!BA!!A1!!@1!!?!!!=Q!!<A1%AU!7\\?L2"
-	"_@HM>I:9-F?80W'41W792WG=4'[B4X'E6(;J7(KN88_S9)+V:9?[;9O_<9`#=:0'"
-	">JD,?JT0@K$4AK48B[H=C[XAD\\(EE\\8IG,LNH,\\RI-,VJ-<ZK-L^J]H]HM$TF\\HM"
-	"E,,FC+L>A;07?:P/=J4(;IS`9Y3X8(SP9'G8R1)$QA!!PA!!OA!!N1!!M!!!L!!!"
-	"K!!!IQ!!HA!!GA!!F1!!E1!!D!!!C!!!AQ!!@Q!!?A!!>A!!=1!!;!%\"DV]B_@LQ"
-	"``\\VH[BU0&[317/72GC<3GS@4H#D5H3H6XGM7HSP8Y'U9Y7Y;)K^;YX!=*,&>*<*"
-	"?:P/@*\\2A;07B;@;CKT@D;`CEL4HFLDLG\\XQHM$TI]8YJ]H]K=P_IM4XG\\XQE\\8I"
-	"D+\\BB+<:@*\\2>*<*<9`#:9?[8I#T6XCL4X'EA$N8S!!!OQ!!NQ!!MA!!LA!!K1!!"
-	"J!!!I!!!H!!!FQ!!EA!!DA!!C1!!B1!!A!!!@!!!>Q!!=Q!!<A!!;1!!LJ*7`P`Z"
-	"````S-SA6(\"`1G3;3'K>4'[B5(+F6(;J78OO88_S99/W:9?[;IS`<J$$=J4(>JD,"
-	"?ZX1@[(5A[89B[H=D+\\BE,,FF,<JG,LNH,\\RI=0WJ=@[K=P_J=@[H<`QF<@PD<,N"
-	"B;LFAK0:?*H,=*,&;9O_99/W7HSP5H3H3'[B6&C&LQM2OA!!N!!!M!!!KQ!!JQ!!"
-	"IA!!HA!!G1!!F1!!E!!!D!!!BQ!!AQ!!@A!!?A!!>1!!=1!!;Q!!>#--TM/7````"
-	"````\\_\\#:8VT2';>3WWA4H#D5X7I6XGM8([R8Y'U:);Z;)K^<9`#=*,&>:@+?:P/"
-	"@:`3A;07BKD<CKT@DL$DEL4HF\\HMG\\XQH](UI]8YK-L^K-L^I=,UGM$`G,\\-E[7;"
-	"E;/;;Z'R>*L7<9W`:);[88_S68?K4H#D2GC<.W7<D3!TO1!!M1!!L1!!K!!!J!!!"
-	"HQ!!GQ!!FA!!EA!!D1!!C1!!B!!!A!!!?Q!!>Q!!=A!!<A!!;!!!@4M6\\`42````"
-	"```````SG;2Z4'W94H#B58/G68?K78OO8I#T9I3X:IC\\;IS`<J$$=Z8)>ZH-@*\\2"
-	"@[(5B+<:C+L>D;`CE,,FF<@KG<POHM$TI=0WJMD\\K=P_J-8VH,\\OC(R0B4EHH%^+"
-	"H&\"+@4%H>WJ.:YG\\99+S7(KN58/G37O?1G/7-G'8;$65MA%#LA%\"KQ!!JA!!IA!!"
-	"H1!!G!!!F!!!E!!!CQ!!BA!!AA!!@A!!?1!!>!!!=!!!;Q%!;A=$IY21```Y````"
-	"````````V>3(6(/45H/D5X7I7(KN8([R9)+V:);Z;9O_<9`#=:0'>:@+?JT0@K$4"
-	"AK48BKD<C[XAD\\(EE\\8IF\\HMH,\\RI-,VJ-<ZK-L^J]DYIM8[F89[B2=@K5&#L4M["
-	"L4M[K%\"\"BBE@CGM\\8)#U68;H47_C27?;0G#4-FK03E\"JKQ-&KQ%#K!!!IQ!!HQ!!"
-	"GA!!FA!!E1!!D1!!C!!!B!!!@Q!!?A!!>A!!=A!!<1!!;A-#;R-(VNK;````````"
-	"`````````0PJB**D4X+P6XGI7HSP8I#T9I3X:YG];YX!<Z(%=Z8)?*L.@*\\2A+,6"
-	"B+<:C;P?D;`CE<0GF<@KGLTPH<`SIM4XJMD\\KMP]H]0`LL3.>1!!HBU=L2%1OB)3"
-	"OB)3L2%1H\"M;>A!!D:.Q2GKL37O=17/7/6O/-&7).U6TJA1(K!%#J1!!I1!!H!!!"
-	"G!!!EQ!!DQ!!CA!!BA!!A1!!@1!!?!!!>!!!<Q!!<!-\":!1%D'9K`0`R````````"
-	"`````P\\]````T-NZ78G?7HSN88_S99/W:9?[;9O_<J$$=J4(>JD,?JT0@K$4A[89"
-	"B[H=D+\\BD\\(EF,<JG,LNH,\\RI-,VJ=@[K=P_J=<[J-X`FFQPAQ!%J!%!Q!!!UQ!!"
-	"UQ!!Q!!!J!)!AA!#DV9K48CK1W380&[2.6?+,&#$,U*SIA1(J1%#IQ!!HA!!G1!!"
-	"F1!!E!!!D!!!BQ!!AQ!!@A!!?A!!>1!!=1!!<!!!;Q1$:AU&TN#.`````P\\^````"
-	"`````````0X]```^D*:*6HP\"9)+S:);Z:YG]<)\\\"=*,&>*<*?*L.@:`3A;07B;@;"
-	"C;P?DL$DEL4HFLDLGLTPH](UI]8YJ]H]K=P_I-(YL><LB4-?D!%$L1%!T1!!\\1!!"
-	"\\1!!T1!!L1%!CQ!#A#]:9)G@0&W5/&K.-6/'*ES!-TNJI11'IQ%#I!!!GQ!!FQ!!"
-	"EQ!!DA!!C1!!B1!!A1!!@!!!>Q!!=Q!!<A!!;Q)\"9A9'E(5J```_`0T\\````````"
-	"`````````P\\^`P\\`WNOP=9C!9)/`:IC\\;IS`<J$$=J4(>ZH-?ZX1@[(5A[89C+L>"
-	"D+\\BE,,FF,<JG<POH<`SI=0WJ=@[K=P_J=@[H,XSIMTOD%5EBQ!$K1)\"RQ!!Y!!!"
-	"Y!!!RQ!!K1)\"BA!\"BU%A58K>/6K0-V7),%[\"(UF^14\"8I1)%I1%\"H1!!G1!!F!!!"
-	"E!!!CQ!!BQ!!AA!!@1!!?1!!>1!!=!!!<!!!:A-$>412X.GV`P\\_`P\\^````````"
-	"`````````````P\\]```^K\\\"Q:Y;N;9K`<)\\\"=:0'>:@+?:P/@:`3AK48B;@;CKT@"
-	"DL$DE\\8IF\\HMG\\XQH](UI]8YK-L^J]H]I=0WGLPMD<4YJ)R7>Q!!H19$MA!!QA!!"
-	"QA!!MA!!H!9$>A!!EHN)-VK>/&G+,V'%+%J^&E:^7C%^J!!!HQ!\"GQ!!FA!!EA!!"
-	"D1!!C1!!B!!!A!!!?Q!!>Q!!=A!!<A!!;1%\";!M%L*N?```_`P\\^````````````"
-	"````````````````````]?`6BZ>R;YX!<Z(#>*<*>ZH-@*\\2A+,6B+<:C+L>D;`C"
-	"E<0GF<@KG<POHM$TIM4XJMD\\K=P_J-<ZH,\\RF<@JD+TBE<()BD9(@A!$G!5$IA-\""
-	"IA-#FA1$@1!!BTA/6H;./&C.-V7(+UW!)U:Z&E\"V?B)BJ1!!H!!!G!!!EQ!!DQ!!"
-	"CA!!BA!!A1!!@1!!?!!!>1!!<Q!!;Q)\":A!!B6AH]@<@````````````````````"
-	"````````````````````````V>/6>Z'6=J4'>:@*?JT0@K$4AK48BKD<C[XAD\\(E"
-	"E\\8IF\\HMH,\\RI-,VJ-<ZK-L^J]H]H](UG,LNE,,FC;P=A+,8AJCC?D9%>1!!@A!!"
-	"@1!!?1!!?41/77^^/VW3.FC+,F#$*EB\\(5&V,D&=F!9,I!!!GA!!FA!!E1!!D1!!"
-	"C!!!B!!!@Q!!?Q!!>A!!=1!!<1%!;A)#=3I0V^WL````````````````````````"
-	"`````````````````````@X\\````O\\NG>J3N?:P2@*\\1A;07B+<:C;P?D;`CEL4H"
-	"F<@KGLTPHM$TI]8YJ]H]K=P_I]8YG\\XQF,<JD+\\BB;@;@:`3>:@,=*3[@)*EC'I_"
-	"C7N$46.237[91''7/6O/-6/'+ER`)U2X'$ZS5#!_KA!!H!!!FQ!!EQ!!DA!!CA!!"
-	"B1!!A1!!@!!!?!!!=Q!!<Q%!;Q)#;B9(P=\"_`````@X]````````````````````"
-	"`````````````````````````0PX````L\\*C@*GPA+0>A[88B[H=C[XAE,,FF,<J"
-	"G,LNH,\\RI=0WJ-<ZK=P_JMD\\HM$TF\\HMD\\(EC+L>A+,6?:P.=:0&;9G]8Y+`6(S^"
-	"3X3U47_J2'370&[1.&;*,5_#*5>[)4^R(4:GF!9,HQ!!GA!!F1!!E!!!D!!!C!!!"
-	"AQ!!@A!!?A!!>1!!=1%!<1-$<\"A(LKJL`````0TY````````````````````````"
-	"`````````````````````````````P\\]``\\^K[^KAJ[VB[L@C;P>DL$DEL4HFLDL"
-	"G\\XQH](UI]8YJ]H]K-L^IM4XGLTPEL4HC[XAA[89@*\\2>*<*<9`#:9?[8H_R6X?J"
-	"4X#C2WC<0W'5.VG--&+&+%J^)U*U&$VR82MVKA!!G1%\"FQ!!EA!!DA!!C1!!B!!!"
-	"A!!!@!!!>Q!!=A%!<Q)#<2=(K;\"H```_`PX]````````````````````````````"
-	"``````````````````````````````````````\\^K;N>BK3_D;`BE,,DF<@KG,LN"
-	"H<`SI=0WJ=@[KMT`J=@[H<`SFLDLDL$DB[H=@[(5?*L.=*,&;9O_9)+V78OO58/G"
-	"3GS@1G38/VW1-V7),%[\"*5:Z(4ZR,#^:JA!!GA%#G1!!F!!!E!!!CQ!!BQ!!AA!!"
-	"@A!!?1!!>!%!=1)#<B5(K+.G```_````````````````````````````````````"
-	"`````````````````````````````````````P\\]````N,.BDK;ME\\8IF\\LPG\\XQ"
-	"I-,VJ-<ZK=P_J]H]I=0WG<POE<0GC;P?AK48?JT0=Z8);YX!:);Z8([R68?K47_C"
-	"2GC<0W'5.FC,,F#$*UF](U*V&TJOEQ=.H!%#GQ!!FA!!E1!!D1!!C!!!B!!!@Q!!"
-	"?Q!!>Q%\"=A!!=#1-M,.X`````@X]````````````````````````````````````"
-	"````````````````````````````````````````_`PX````TMS6G+?%G<D@H]0_"
-	"IM0UJMD\\K=P_J-<ZH,\\RF<@KD;`CB;@;@K$4>JD,<Z(%:YG]8Y'U7(KN5(+F37O?"
-	"17/7/FS0-F3(+ER`)U6Y&T^U=R1GI1!!H1!!G!!!EQ!!DQ!!CQ!!BA!!A1!!@1%!"
-	"?Q-$=QE#?EA@S>#E````_`PY````````````````````````````````````````"
-	"`````````````````````````````````````````````@X\\````\\/P6M,:WH,/K"
-	"K-X`KMP]J]DYH](UG,LNE,,FC+L>A;07?:P/=J4(;IS`9Y7Y7XWQ5X7I4'[B2';:"
-	"06_3.6?+,6#$+%>Z'U*W7S!\\K!!!HA!!GQ!!F1!!E1!!D!!!C!!!AQ)!A11$@Q5&"
-	"=31*F9*3[?\\<`````@X]````````````````````````````````````````````"
-	"`````````````````````````````````````````````````````````P\\^WNOQ"
-	"H[F=J]<KJ-D`G\\XNF,<HD+\\BB+<:@*\\2>:@+<9`#:IC\\8I#T6XGM4X'E3'K>1'+6"
-	"/6O/-6/'+UJ](U2X4CB*KQ!!I!!!H!!!FQ!!EQ!!DA!!C1%!B!)\"B11%?1A$<EQ6"
-	"S]?L`P`_````````````````````````````````````````````````````````"
-	"`````````````````````````````````````````````````````````P\\]````"
-	"```_R]>VI\\+#G,<7E,$=B[HA@[(8?*L/=:0';IO_9I3X7HSP5H3H3GS@1W79/VW1"
-	".&;*,%[\")5B^4CN.LA!!HA)$HA!!G1!!F1!!EA!!D1!!B11\"@AI$=D]9I[:Y```_"
-	"`P\\_`@X]````````````````````````````````````````````````````````"
-	"`````````````````````````````````````````````````````````````P\\^"
-	"`@X]````_0@KUN#&M<S3E;G?BK'P=J8*:YL-9I<#8(_W6XGL58+C37O<1'+4/6O-"
-	"-&3')U_$83N)M!%\"I11&IA)#I11%H1!!E1!\"@QY#>BI&BFI\\J[S%]@<M`````0P["
-	"`P\\^````````````````````````````````````````````````````````````"
-	"````````````````````````````````````````````````````````````````"
-	"`````P\\]`````````@PS\\/O`UN;JM\\S'E[.UA:;';)7;4H'I07/G.VS>,F/6*UK-"
-	")5#\"=1UOKA!!I!!!HA!!H2Q+A#!':C!#A6I\\KZO$T^<#^0PT`````````@X]````"
-	"````````````````````````````````````````````````````````````````"
-	"````````````````````````````````````````````````````````````````"
-	"`````````````````````````````PXV_PLN\\O`5X>_KU^3*QM:WK\\6NH;FDE[*A"
-	"L*>+T:)ZV+B1X]BP[N_/V][BX.D)\\O`K^PHV````````````````````````````"
-	"````````````````````````````````````````````````````````````````"
-	"";
+/*  GIMP header image file format (RGB): C:\EAP\PLH40\PROJECT\upscale\src\app\def-img-data.h  */
+
+static unsigned int width = 64;
+static unsigned int height = 64;
+
+/*  Call this macro repeatedly.  After each use, the pixel data can be extracted  */
+
+#define HEADER_PIXEL(data,pixel) {\
+pixel[0] = (((data[0] - 33) << 2) | ((data[1] - 33) >> 4)); \
+pixel[1] = ((((data[1] - 33) & 0xF) << 4) | ((data[2] - 33) >> 2)); \
+pixel[2] = ((((data[2] - 33) & 0x3) << 6) | ((data[3] - 33))); \
+data += 4; \
+}
+static char *header_data =
+	"````````````````````````````````````````````````````````````````"
+	"```````````````````````````````V_PLN\\?\\4W^[IUN3)Q=>XL\\FRJL2QJ;>A"
+	"M99OOZ1^S[F1X-BP[>[.VMW@X.D(\\P$K^@HV````````````````````````````"
+	"````````````````````````````````````````````````````````````````"
+	"````````````````````````````````````````````````````````````````"
+	"`````P\\]```````````S]?`#S-S@I;JV@9V?;I\"S6H/*2'??1'7J2G_S4F?0:A)6"
+	"=1!!?1!!A!!!BQ!!EQ!!HBQ+C3!(>#%$D&I[MJK#T.<\"]PLT`````````@X]````"
+	"````````````````````````````````````````````````````````````````"
+	"`````````````````````````````````````````````````````````````P\\^"
+	"`0X]`````PTKV./(DZNR7H&H4'BX/&K/.6G;0G+>2'??4'S?5(3F7V6X<Q-#?!!!"
+	"@1)\"B1)\"D1-#F1-#H!)#IQ)#LA1%O!%\"O!%\"K!Y#HRM&IFM]J+O$[`<L`````@P["
+	"`P\\^````````````````````````````````````````````````````````````"
+	"`````````````````````````````````````````````````````````P\\]`P\\`"
+	"```^S=BW=(^2.V6W.&7!-&/+.6C//VW21'+62';:37G=47_C6F&W<!!!=Q!!?A!!"
+	"A1!!C1!!E1!!FQ!!HA!!JA!!L1!!N1!!P!!!R1!!T1!!T11\"T!I$HU!;I;:X`P\\^"
+	"``\\_`@X]````````````````````````````````````````````````````````"
+	"```````````````````````````````````````````````````````````^VN?L"
+	">9!U,5RS*5G&-&'\"-6/&.6?+/FS00G#41G382GC<3G_D6&2Z;!!!<Q1&>Q!!@A!!"
+	"B1!!D!!!F!!!H!!!IQ!!K1!!M1!!O1!!Q!!!S!!!TQ!!V1%!WQ)\"\\!1%Y1E$EUQ6"
+	"TM?K`@`_````````````````````````````````````````````````````````"
+	"`````````````````````````````````````````````@X\\````]P$5FZZ>2&N5"
+	"'4[%+EN],5^`,V'%-V7)/&K.0&[21'+62';:3'_E56?!:A!!<!1&=Q!!?Q!!AA!!"
+	"CA!!E1!!G!!!I!!!JQ!!LA!!NA!!P1!!R!!!T!!!UQ!!WA!!YA!!ZQ)!\\Q-#`Q5&"
+	"T31+LY*2YO\\;`````@X]````````````````````````````````````````````"
+	"````````````````````````````````````````_`PX````V./58'R)*%2L(E&^"
+	"*EBY+5N_,F#$-F3(.FC,/FS00W'51W792GK>47'/9!M1;1!!=1!!?!!!@Q!!BQ!!"
+	"D1!!F1!!H1!!J!!!KQ!!MQ!!OA!!Q1!!S1!!U!!!W!!!XQ!!ZA!!\\1!!^1!!_A%!"
+	"`Q-$\\QA$O5A@Q=_E````_`PY````````````````````````````````````````"
+	"`````````````````````````````````````@X]````N<6B.5Z4'TVQ(U&W*%:Y"
+	"*UF],%[\"-&+&.6?+/&K.06_317/72G;:3GC;7C!P:Q!!<A!!>!!!@!!!B!!!CQ!!"
+	"EA!!GA!!I1!!K!!!LQ!!NQ!!PA!!RA!!T1!!V!!!WQ!!YQ!![A!!]A!!_A!!`A!!"
+	"_Q!!_!%\"]A!!TS1.L<.X`````PX]````````````````````````````````````"
+	"```````````````````````````````````````^I[27*5*<'TVO(U\"R)E2X*EB\\"
+	"+ER`,F#$-F3(.VG-/VW10W'51W373'O@5E*B:!!!;A)#=A!!?1!!A1!!C!!!DQ!!"
+	"FA!!HA!!J1!!L1!!N!!!OA!!QA!!SA!!U1!!W1!!Y!!!ZQ!!\\A!!^A!!`1!!`!!!"
+	"_!!!^!!!\\A%![A)#VR5(LK.G`P`_````````````````````````````````````"
+	"`````````````````````````````@X]```^I+.>*5*9&TJP($ZQ)%*V)U6Y+%J^"
+	",%[\"-6/'.6?+/6O/06_31G382G;:3W359!!!:Q-&<Q!!>A!!@1!!B!%!CQ%\"EA!\""
+	"G1!!I1%\"K1%!M!!!O!!!PQ!!RQ!!TA!!V1!!X!!!Z!!![Q!!]Q!!_A!!`A!!_A!!"
+	"^A!!]1!!\\1!!ZQ%!ZA)#U\"=)NK\"G`@`_`P\\]````````````````````````````"
+	"`````````````````````````0TX````K+J;*%&8%T6R'DRO(E\"T)U2X*EB\\+UW!"
+	",V'%-V7).VG-0&[21'+627792X3L72]N:!!!;Q%\"=Q!!?A!!AA)\"C!!#FA!!J\"1!"
+	"L29!LA!!LQ!\"N!)\"P!!!QQ!!SQ!!UA!!WA!!Y1!![!!!]!!!^Q!!`1!!`!!!^Q!!"
+	"]Q!!\\A!![A!!Z1!!Y1%!Y!-$SBA)N;JK````_`TY````````````````````````"
+	"`````````````````````@X\\````P<RH)DZ8&$:M'$JM($ZR)%*V*5>[+5N_,5_#"
+	"-6/'.FC,/FS00G#41G382GO@4F?!9!1';!%#=!!!>Q!!@Q)!B1!!C#E$:VYY;G^J"
+	";G^L4%%UHC1+O1!!Q!)!S!!!TQ!!VQ!!XA!!Z1!!\\!!!^!!!_Q!!`1!!_1!!^1!!"
+	"]1!!\\!!!ZQ!!YQ!!XA!!W1%!VQ)#RB=)OL^^`````@X]````````````````````"
+	"````````````````````````WNG7-EJ/&$:I&TFL'DRP(U&U)U6Y*UF]+UW!-&+&"
+	"-V7)/&K.0&[217/727;:2X/J7#V#:A!!<1!!=Q!!?Q)\"AA!!BEM?272S:XC>=9+B"
+	"=9+B;HK>0W*VH5=CRA!!SQ)\"UQ!!WQ!!YA!![A!!]1!!_!!!`A!!_Q!!^Q!!]A!!"
+	"\\1!![1!!Z1!!Y!!!WQ!!VQ!!UA%!TA)#P3I0U.WK````````````````````````"
+	"````````````````````^0057WN'%$*F&D>I'4NO(4^S)5.W*5>[+5N_,F#$-F3("
+	".FC,/FS00W'51W792WK?4'758R5?;A!!=1!!?1%!?Q!!G5!6/FRM5G/,88;99XSC"
+	"9XSC8(79673,.6NNRTY9TA!!W!%\"XQ!!ZA!!\\1!!^1!!`1!!`1!!_1!!^!!!]!!!"
+	"[Q!!ZQ!!YA!!XA!!W1!!V1!!U!!!SQ)\"RQ!!MVAH\\@<?````````````````````"
+	"`````````````P\\]```^GK\"@&T>?%D6K&DBM'TVQ(U&U*%:Z+%J^,%[\"-&+&.6?+"
+	"/6O/06_317/72GC<37[C5F:^:A1'<A!!>1!!@!%\"BA!!?H2-,56W4'?/7HCE:93T"
+	":93T7HCE4'?/,U6WAX2-X1!!WA%\"YQ!![Q!!]A!!_1!!`A!!_A!!^A!!]1!!\\1!!"
+	"[!!!Z!!!XQ!!WQ!!VA!!UA!!T1!!S1!!R1%\"P!M%P:J?`P`_`P\\^````````````"
+	"`````````P\\^`P\\`W.GN/V*+$#^L&D>K'4NO(4^S)E2X*EB\\+ER`,F#$-V7).VG-"
+	"/VW10W'52';:2WG=4('G6URO<!!!=A!!?1!!@A!!HRY%56R</F&\\5'W8:)3S>ZD+"
+	">ZD+:)3S5'W8/V&\\66R=[RY&XA!![!!!\\A!!^A!!`A!!`1!!_!!!^!!!\\Q!![Q!!"
+	"ZA!!Y1!!X1!!W1!!V!!!TQ!!SQ!!RQ!!QA!!Q!-$LT13XNGU``\\_`P\\^````````"
+	"`````````0T\\```^>8]T\"3BP&4>H'$JN'TVQ)%*V*%:Z+5N_,5_#-6/'.6?+/6O/"
+	"0G#41G382GC<3GS?4H+G8%\"?=1!!>Q!!@1!!A1!!IR]%5&N</F.]5'[8:)3S?*H,"
+	"?*H,:)3S5'[8/V.]66N=\\R]&YA!!\\!!!]Q!!_Q!!`1!!_A!!^1!!]1!!\\!!![!!!"
+	"YQ!!XQ!!WA!!VA!!U1!!T1!!S!!!QQ!!PQ!!OA)\"O15&K(5J```_`@T\\````````"
+	"`````P\\]````T=V['$>>&4:H&DBL'DRP(E\"T)E2X*UF]+ER`,V'%-V7)/&K./VW1"
+	"1'+62';:37O?4'[B583I9$Z9>1!!?A!!AA!!C!%\"F1!!?X2-,E2V3W?.78?E:)3S"
+	":)3S78?E3W?.-%2VAX./[Q!!ZQ%\"]!!!^Q!!`A!!`!!!_!!!]Q!!\\A!![A!!Z1!!"
+	"Y1!!X!!!W!!!UQ!!TQ!!SA!!RA!!Q1!!P1!!O!!!N1-#L1U&T.#-`````P\\^````"
+	"``````````\\K;(:(#SZL&DBH'$JN($ZR)5.W*5>[+5N_,5_#-F3(.FC,/FS00G#4"
+	"1W792WG=3WWA4X'D5X?L9U.@?A!!@Q!!BA!!DA%\"E!!!K5%7-V>J/UZ\\3G;.5'W9"
+	"5'W9377.05Z[,F:LV5!9YQ!!\\!%\"^!!!`!!!`A!!_1!!^!!!]!!!\\!!!ZQ!!YA!!"
+	"XA!!W1!!V1!!U!!!T!!!RQ!!QQ!!PA!!OA!!N1!!M1-\"LA1%KW9L_@`R````````"
+	"````````V^7*(DR=&4>H&DBL'TVQ(E\"T)U6Y*UF],%[\",V'%.&;*/&K.06_31'+6"
+	"27?;37O?47_C58/G68SQ9F&U@A!!AQ!!CA!!EA!!G1)\"I!!!F5Y@,6*G-EBY/V.]"
+	"0&.].5NX+&&IKEEFYQ!![!)\"]A!!_!!!`A!!_Q!!^Q!!]A!!\\A!![1!!Z!!!Y!!!"
+	"X!!!VQ!!UA!!TA!!SA!!R1!!Q!!!P!!!NQ!!MQ!!LA!!KA-#JB)(V.G;````````"
+	"```````SB*&G&D>C&D>J'4NO(4^S)5.W*EB\\+ER`,F#$-F3(.VG-/VW10W'51W79"
+	"3'K>3WWA5(+F6(;J7(WR9W'*@Q5)C!!!DA!!FA!!H1!!J1)!L!!!ISU&:&EX4&.6"
+	"3V*94$UTO3A-Y1!!ZA)!\\A!!^1!!`1!!`1!!_!!!^!!!\\Q!![Q!!ZA!!YA!!X1!!"
+	"W1!!V!!!U!!!SQ!!RA!!QA!!PA!!O1!!N!!!M!!!L!!!JQ%!IA=$O9.1`@`Y````"
+	"````]P$%1VJ1$T*J&TFM'TVQ)%*V)U6Y+%J^,%[\"-6/'.&;*/6O/06_317/727?;"
+	"3GS@4H#D5H3H6HCL7X[R9(SN@BMFD!!!EQ!!GA!!IA!!K!!!LQ)\"NQ!\"S!!!V2M!"
+	"X2U$XA!!XA!!YA)\"[Q!!]A!!_A!!`A!!_Q!!^A!!]1!!\\1!![1!!Z!!!XQ!!WQ!!"
+	"VA!!UA!!T1!!S1!!R!!!Q!!!OQ!!NQ!!MA!!LA!!K1!!J1!!HQ!!IDM6\\042````"
+	"````Q];;,UJ;%D6L'DRP(4^S)E2X*EB\\+UW!,F#$-V7).VG-0&[20W'52';:3'K>"
+	"47_C5(+F68?K78OO8I#T8YT$?%*<E!%\"FQ!\"HA!!JA!!L1!!N!!!OQ%!Q1%\"S!!!"
+	"U!!!W!%\"Y!%![!!!\\A!!^A!!`1!!`!!!_!!!]Q!!\\Q!![A!!Z1!!Y1!!X1!!W!!!"
+	"UQ!!TQ!!SA!!RA!!Q1!!P1!!O!!!N!!!LQ!!KQ!!JA!!IA!!H1!!H3)-V-/7````"
+	"```VEZRH%D2J&TFN($ZR)%*V*%:Z+%J^,5_#-6/'.6?+/6O/0G#41G382GC<3GS@"
+	"4X'E5X7I6XGM7XWQ8Y'U:);[;9C[E1I/GQ-%IQ!!KQ!!M1!!O!!!Q!!!RQ!!TQ!!"
+	"V1!!X1!!Z!!!\\!!!]Q!!_Q!!`A!!_A!!^1!!]1!!\\!!![!!!YQ!!XQ!!WA!!VA!!"
+	"U1!!T1!!S!!!R!!!PQ!!OQ!!NA!!MA!!L1!!K!!!J!!!I!!!GQ!!F1!!OJ*7`@`Z"
+	"_PHN:(2'#T\"Q'DRP(U&U)E2X*UF]+UW!-&+&-V7)/&K.0&[217/72';:37O?47_C"
+	"58/G68?K7HSP8I#T9I3X:Y?[;:$&@FZ`I!!!JA)$LA!!NA!!P1!!QQ!!SQ!!UQ!!"
+	"WA!!YA!![1!!]!!!^Q!!`A!!`!!!^Q!!]A!!\\A!![1!!Z1!!Y!!!X!!!VQ!!UQ!!"
+	"TA!!SA!!R1!!Q1!!P!!!O!!!MQ!!LQ!!KA!!JA!!I1!!H!!!G!!!E1%\"IF]B_@LQ"
+	"[?L03W&3&$>T($ZR)5.W*5>[+5N_,5_#-F3(.FC,/FS00G#41G382WG=3WWA4X'E"
+	"5X7I7(KN8([R9)+V:);Z;9O_<IS_<ZP2EDN0LA!!M1)$OA!!Q1!!S!!!U!!!W!!!"
+	"XA!!ZA!!\\1!!^!!!`!!!`A!!_!!!^1!!]!!!\\!!!ZQ!!YQ!!XA!!W1!!V1!!U1!!"
+	"T!!!RQ!!QQ!!PA!!OA!!N1!!M1!!L!!!K!!!IQ!!HQ!!GA!!FA!!E11%G5!7\\OL2"
+	"UN7B,ENB'4RS(U&U)U6Y*UF],%[\"-&+&.&;*/&K.06_317/727?;37O?4H#D5H3H"
+	"6HCL7HSP8Y'U9Y7Y:YG];YX!<Z,&>:0'?*L-I3Y^O1!!PA%#R1!!T1!!V!!!WQ!!"
+	"YQ!![A!!]A!!_1!!`A!!_Q!!^A!!]A!!\\1!![1!!Z!!!Y!!!WQ!!VQ!!UA!!T1!!"
+	"S1!!R1!!Q!!!OQ!!NQ!!MQ!!LA!!K1!!J1!!I!!!H!!!FQ!!EQ!!DA)#DRY+X.3D"
+	"Q]6\\&4BP)%*T)E2W*5>[+ER`,F#$-V7).FC,/VW10W'52';:2WG=4'[B5(+F68?K"
+	"7(KN88_S99/W:9?[;9O_<J$$=J4(>JD,?J\\2A:X/L3EWQA!!S1%\"U1!!W!!!Y!!!"
+	"ZQ!!\\A!!^1!!`1!!`1!!_!!!^!!!]!!![Q!!ZA!!YA!!X1!!W1!!V!!!U!!!SQ!!"
+	"RQ!!QA!!PA!!O1!!N1!!M!!!KQ!!JQ!!IQ!!HA!!G1!!F1!!E!!!D1)#B1!!TM3!"
+	"L,&D$4*V)U2V*%:Z+%J^,%[\"-6/'.6?+/6O/06_31G382GC<3GS@4H#D5H3H6XGM"
+	"7XWQ8Y'U9Y7Y;)K^<)\\\"=*,&>*<*?:P/@:`3AK,6B+P?N4.\"T1%\"V1!!X!!\"Z!!!"
+	"[Q!!]Q!!_A!!`A!!_A!!^A!!]1!!\\1!![!!!Z!!!XQ!!WA!!VA!!UA!!T1!!S!!!"
+	"R!!!Q!!!OQ!!NA!!MA!!L1!!K1!!J!!!I!!!GQ!!FQ!!EA!!D1!!CA-#A!!!PKJ@"
+	"EJR7%D>X*%:X*EB\\+ER`,V'%-V7).VG-/VW11'+61W793'K>4'[B58/G68?K78OO"
+	"88_S9I3X:IC\\;IS`<J$$=Z8)>JD,?ZX1@[(5B+89C;88C,HPM6FSW!9(YQ!!ZQ)#"
+	"\\Q!!^A!!`A!!`!!!_!!!]Q!!\\Q!![A!!ZA!!Y1!!X1!!W!!!V!!!TQ!!SQ!!RA!!"
+	"QA!!P1!!O!!!N!!!M!!!KQ!!JA!!IA!!H1!!G1!!F!!!E!!!CQ!!BQ-#@A!!M*\"'"
+	"AIR,&$F\\*EBZ+5N_,5_#-F3(.6?+/FS00G#41G382GC<3WWA4X'E5X7I6XGM8([R"
+	"9)+V:9?[;)K^<9`#=:0'>:@+?:P/@K$4AK48BKD<CKT@E+\\BD\\`UJJ#XW#1N]1!!"
+	"]15'_Q%\"`A!!_1!!^1!!]1!!\\!!!ZQ!!YQ!!XA!!WA!!V1!!U1!!T!!!S!!!QQ!!"
+	"PQ!!OA!!NA!!M1!!L!!!K!!!J!!!HQ!!GA!!FA!!E1!!D1!!C!!!B1)\"?A!!J(QR"
+	"?I:)&TR_+%J\\+UW!,V'%.&;*/&K.0&[21'+627?;37O?47_C58/G6HCL7HSP8I#T"
+	"9I3X:IC\\;YX!<Z(%=Z8)>ZH-@*\\2A+,6B+<:C+L>D;`CE<0GF<@KG,\\RH\\XPR7[)"
+	"_A!!`1)$_Q)#^Q!!]Q!!\\A!![1!!Z1!!Y1!!X!!!VQ!!UQ!!TA!!SA!!R1!!Q1!!"
+	"P!!!O!!!MQ!!LQ!!KA!!JA!!I1!!H1!!G!!!F!!!DQ!!CQ!!BA!!AQ)\"?!!!HH1I"
+	"@)B*'D_!+UR^,F#$-F3(.FC,/FS00W'51W792WG=3WWA5(+F5X7I7(KN8([R99/W"
+	":);Z;9O_<9`#=J4(>:@+?JT0@K$4A[89BKD<C[XAD\\(EE\\8IG,LNH,\\RIL`RI]@["
+	"L<\\MZD>$_A!!^1!!]!!![Q!!ZQ!!YA!!X1!!W1!!V1!!U!!!SQ!!RQ!!QQ!!PA!!"
+	"O1!!N1!!M!!!L!!!JQ!!IQ!!HA!!GA!!F1!!E1!!D!!!C!!!AQ!!@Q)\">1!!H81I"
+	"B)^.(5'$,5_!-&+&.&;*/6O/06_317/727?;37O?4H#D5H3H6HCL7HSP8Y'U9Y7Y"
+	":YG];YX!=*,&>*<*?*L.@*\\2A;07B;@;C;P?D;`CEL4HF<@KGLTPHM$TIM8YJ]<Z"
+	"K=L^H>(`PH;5[2)8]1!!ZQ-%Z1!!Y!!!WQ!!VQ!!UA!!TA!!S1!!R1!!Q!!!P!!!"
+	"NQ!!MQ!!LA!!KA!!J1!!I1!!H!!!G!!!EQ!!DA!!CA!!B1!!A1!!@1)\"=Q!!I8QR"
+	"F:Z:)%3&-6+#-V7).VG-/VW10W'52';:3'K>4'[B5(+F68?K78OO88_S99/W:IC\\"
+	";IS`<J$$=J4(>JD,?ZX1@[(5A[89B[H=D+\\BE,,FF,<JG,LNH<`SI-,VJ=<ZKMT`"
+	"JM@[H\\\\QE=0ZH*D$TT!_\\1!!XQ-%X1!!W!!!V!!!TQ!!SQ!!RA!!QA!!P1!!O1!!"
+	"N!!!M!!!KQ!!JQ!!IA!!HA!!G1!!F!!!E!!!D!!!BQ!!AA!!@A!!?Q-#=!!!L*\"'"
+	"L\\2G)57)-V7&.6?+/6O/06_31G382GC<3GS@4H#D5X7I6XGM7XWQ8Y'U:);Z:YG]"
+	"<)\\\"=*,&>:@+?*L.@:`3A;07BKD<C;P?DL$DEL4HF\\HMGLTPH](UI]8YK-L^K-L^"
+	"IM4XGLTPEL0GC;\\CBK$2OE&8YQ!!WA!\"VA!!UA!!T1!!S1!!R!!!PQ!!OQ!!NQ!!"
+	"MA!!L1!!K1!!J!!!I!!!GQ!!FQ!!EA!!DA!!C1!!B1!!A!!!@!!!?1-#<!!!O[NB"
+	"R->^+U[&.F;*/&K./VW11'+62';:37O?47_C58/G68?K78OO8I#T9I3X:IC\\;IS`"
+	"<Z(%=Z8)>ZH-?ZX1A+,6B+<:C+L>D+\\BE<0GF,<JG<POH<`SIM4XJ=@[K=P_J-<Z"
+	"H<`SF<@KDL$DBKD<A+$4>*X2M$V4WA!!UQ%\"TQ!!SA!!RA!!Q1!!P1!!O!!!MQ!!"
+	"LQ!!KQ!!JA!!I1!!H1!!G1!!F!!!DQ!!CQ!!BA!!AA!!@1!!?1!!>A)#<1!!T-7\""
+	"V.?D27*X.6?//FS00G#41G382WG=3GS@4X'E5X7I7(KN7XWQ9)+V:);Z;9O_<)\\\""
+	"=:0'>:@+?JT0@:`3AK48BKD<C[XADL$DE\\8IF\\HMG\\XQH](UJ-<ZK-L^K-L^I-,V"
+	"G<POE<0GC;P?AK48?JT0>*0&::4+L$&%V1!!SA)$S!!!QQ!!PQ!!OA!!NA!!M1!!"
+	"L1!!K!!!J!!!HQ!!GQ!!FA!!E1!!D1!!C1!!B!!!@Q!!?Q!!>Q!!=1)#>RY,WN/D"
+	"[OP18X:H.6G50&[217/727?;37O?47_C5H3H6HCL7HSP8I#T9Y7Y:YG];YX!<Z(%"
+	">*<*>ZH-@*\\2A+,6B;@;C+L>D;`CE<0GFLDLG<POHM$TIM4XJMD\\K=P_J-<ZH,\\R"
+	"F,<JD;`CB;@;@:`3>JD,<J$$;)?Z8I+WN\"QIT!!!R1%\"Q!!!P!!!NQ!!MQ!!LA!!"
+	"KA!!J1!!I1!!H!!!G!!!EQ!!DQ!!CA!!BA!!A1!!@1!!?!!!=Q!!<A1%AU!7\\?L2"
+	"_@HM>I:9-F?80W'41W792WG=4'[B4X'E6(;J7(KN88_S9)+V:9?[;9O_<9`#=:0'"
+	">JD,?JT0@K$4AK48B[H=C[XAD\\(EE\\8IG,LNH,\\RI-,VJ-<ZK-L^J]H]HM$TF\\HM"
+	"E,,FC+L>A;07?:P/=J4(;IS`9Y3X8(SP9'G8R1)$QA!!PA!!OA!!N1!!M!!!L!!!"
+	"K!!!IQ!!HA!!GA!!F1!!E1!!D!!!C!!!AQ!!@Q!!?A!!>A!!=1!!;!%\"DV]B_@LQ"
+	"``\\VH[BU0&[317/72GC<3GS@4H#D5H3H6XGM7HSP8Y'U9Y7Y;)K^;YX!=*,&>*<*"
+	"?:P/@*\\2A;07B;@;CKT@D;`CEL4HFLDLG\\XQHM$TI]8YJ]H]K=P_IM4XG\\XQE\\8I"
+	"D+\\BB+<:@*\\2>*<*<9`#:9?[8I#T6XCL4X'EA$N8S!!!OQ!!NQ!!MA!!LA!!K1!!"
+	"J!!!I!!!H!!!FQ!!EA!!DA!!C1!!B1!!A!!!@!!!>Q!!=Q!!<A!!;1!!LJ*7`P`Z"
+	"````S-SA6(\"`1G3;3'K>4'[B5(+F6(;J78OO88_S99/W:9?[;IS`<J$$=J4(>JD,"
+	"?ZX1@[(5A[89B[H=D+\\BE,,FF,<JG,LNH,\\RI=0WJ=@[K=P_J=@[H<`QF<@PD<,N"
+	"B;LFAK0:?*H,=*,&;9O_99/W7HSP5H3H3'[B6&C&LQM2OA!!N!!!M!!!KQ!!JQ!!"
+	"IA!!HA!!G1!!F1!!E!!!D!!!BQ!!AQ!!@A!!?A!!>1!!=1!!;Q!!>#--TM/7````"
+	"````\\_\\#:8VT2';>3WWA4H#D5X7I6XGM8([R8Y'U:);Z;)K^<9`#=*,&>:@+?:P/"
+	"@:`3A;07BKD<CKT@DL$DEL4HF\\HMG\\XQH](UI]8YK-L^K-L^I=,UGM$`G,\\-E[7;"
+	"E;/;;Z'R>*L7<9W`:);[88_S68?K4H#D2GC<.W7<D3!TO1!!M1!!L1!!K!!!J!!!"
+	"HQ!!GQ!!FA!!EA!!D1!!C1!!B!!!A!!!?Q!!>Q!!=A!!<A!!;!!!@4M6\\`42````"
+	"```````SG;2Z4'W94H#B58/G68?K78OO8I#T9I3X:IC\\;IS`<J$$=Z8)>ZH-@*\\2"
+	"@[(5B+<:C+L>D;`CE,,FF<@KG<POHM$TI=0WJMD\\K=P_J-8VH,\\OC(R0B4EHH%^+"
+	"H&\"+@4%H>WJ.:YG\\99+S7(KN58/G37O?1G/7-G'8;$65MA%#LA%\"KQ!!JA!!IA!!"
+	"H1!!G!!!F!!!E!!!CQ!!BA!!AA!!@A!!?1!!>!!!=!!!;Q%!;A=$IY21```Y````"
+	"````````V>3(6(/45H/D5X7I7(KN8([R9)+V:);Z;9O_<9`#=:0'>:@+?JT0@K$4"
+	"AK48BKD<C[XAD\\(EE\\8IF\\HMH,\\RI-,VJ-<ZK-L^J]DYIM8[F89[B2=@K5&#L4M["
+	"L4M[K%\"\"BBE@CGM\\8)#U68;H47_C27?;0G#4-FK03E\"JKQ-&KQ%#K!!!IQ!!HQ!!"
+	"GA!!FA!!E1!!D1!!C!!!B!!!@Q!!?A!!>A!!=A!!<1!!;A-#;R-(VNK;````````"
+	"`````````0PJB**D4X+P6XGI7HSP8I#T9I3X:YG];YX!<Z(%=Z8)?*L.@*\\2A+,6"
+	"B+<:C;P?D;`CE<0GF<@KGLTPH<`SIM4XJMD\\KMP]H]0`LL3.>1!!HBU=L2%1OB)3"
+	"OB)3L2%1H\"M;>A!!D:.Q2GKL37O=17/7/6O/-&7).U6TJA1(K!%#J1!!I1!!H!!!"
+	"G!!!EQ!!DQ!!CA!!BA!!A1!!@1!!?!!!>!!!<Q!!<!-\":!1%D'9K`0`R````````"
+	"`````P\\]````T-NZ78G?7HSN88_S99/W:9?[;9O_<J$$=J4(>JD,?JT0@K$4A[89"
+	"B[H=D+\\BD\\(EF,<JG,LNH,\\RI-,VJ=@[K=P_J=<[J-X`FFQPAQ!%J!%!Q!!!UQ!!"
+	"UQ!!Q!!!J!)!AA!#DV9K48CK1W380&[2.6?+,&#$,U*SIA1(J1%#IQ!!HA!!G1!!"
+	"F1!!E!!!D!!!BQ!!AQ!!@A!!?A!!>1!!=1!!<!!!;Q1$:AU&TN#.`````P\\^````"
+	"`````````0X]```^D*:*6HP\"9)+S:);Z:YG]<)\\\"=*,&>*<*?*L.@:`3A;07B;@;"
+	"C;P?DL$DEL4HFLDLGLTPH](UI]8YJ]H]K=P_I-(YL><LB4-?D!%$L1%!T1!!\\1!!"
+	"\\1!!T1!!L1%!CQ!#A#]:9)G@0&W5/&K.-6/'*ES!-TNJI11'IQ%#I!!!GQ!!FQ!!"
+	"EQ!!DA!!C1!!B1!!A1!!@!!!>Q!!=Q!!<A!!;Q)\"9A9'E(5J```_`0T\\````````"
+	"`````````P\\^`P\\`WNOP=9C!9)/`:IC\\;IS`<J$$=J4(>ZH-?ZX1@[(5A[89C+L>"
+	"D+\\BE,,FF,<JG<POH<`SI=0WJ=@[K=P_J=@[H,XSIMTOD%5EBQ!$K1)\"RQ!!Y!!!"
+	"Y!!!RQ!!K1)\"BA!\"BU%A58K>/6K0-V7),%[\"(UF^14\"8I1)%I1%\"H1!!G1!!F!!!"
+	"E!!!CQ!!BQ!!AA!!@1!!?1!!>1!!=!!!<!!!:A-$>412X.GV`P\\_`P\\^````````"
+	"`````````````P\\]```^K\\\"Q:Y;N;9K`<)\\\"=:0'>:@+?:P/@:`3AK48B;@;CKT@"
+	"DL$DE\\8IF\\HMG\\XQH](UI]8YK-L^J]H]I=0WGLPMD<4YJ)R7>Q!!H19$MA!!QA!!"
+	"QA!!MA!!H!9$>A!!EHN)-VK>/&G+,V'%+%J^&E:^7C%^J!!!HQ!\"GQ!!FA!!EA!!"
+	"D1!!C1!!B!!!A!!!?Q!!>Q!!=A!!<A!!;1%\";!M%L*N?```_`P\\^````````````"
+	"````````````````````]?`6BZ>R;YX!<Z(#>*<*>ZH-@*\\2A+,6B+<:C+L>D;`C"
+	"E<0GF<@KG<POHM$TIM4XJMD\\K=P_J-<ZH,\\RF<@JD+TBE<()BD9(@A!$G!5$IA-\""
+	"IA-#FA1$@1!!BTA/6H;./&C.-V7(+UW!)U:Z&E\"V?B)BJ1!!H!!!G!!!EQ!!DQ!!"
+	"CA!!BA!!A1!!@1!!?!!!>1!!<Q!!;Q)\":A!!B6AH]@<@````````````````````"
+	"````````````````````````V>/6>Z'6=J4'>:@*?JT0@K$4AK48BKD<C[XAD\\(E"
+	"E\\8IF\\HMH,\\RI-,VJ-<ZK-L^J]H]H](UG,LNE,,FC;P=A+,8AJCC?D9%>1!!@A!!"
+	"@1!!?1!!?41/77^^/VW3.FC+,F#$*EB\\(5&V,D&=F!9,I!!!GA!!FA!!E1!!D1!!"
+	"C!!!B!!!@Q!!?Q!!>A!!=1!!<1%!;A)#=3I0V^WL````````````````````````"
+	"`````````````````````@X\\````O\\NG>J3N?:P2@*\\1A;07B+<:C;P?D;`CEL4H"
+	"F<@KGLTPHM$TI]8YJ]H]K=P_I]8YG\\XQF,<JD+\\BB;@;@:`3>:@,=*3[@)*EC'I_"
+	"C7N$46.237[91''7/6O/-6/'+ER`)U2X'$ZS5#!_KA!!H!!!FQ!!EQ!!DA!!CA!!"
+	"B1!!A1!!@!!!?!!!=Q!!<Q%!;Q)#;B9(P=\"_`````@X]````````````````````"
+	"`````````````````````````0PX````L\\*C@*GPA+0>A[88B[H=C[XAE,,FF,<J"
+	"G,LNH,\\RI=0WJ-<ZK=P_JMD\\HM$TF\\HMD\\(EC+L>A+,6?:P.=:0&;9G]8Y+`6(S^"
+	"3X3U47_J2'370&[1.&;*,5_#*5>[)4^R(4:GF!9,HQ!!GA!!F1!!E!!!D!!!C!!!"
+	"AQ!!@A!!?A!!>1!!=1%!<1-$<\"A(LKJL`````0TY````````````````````````"
+	"`````````````````````````````P\\]``\\^K[^KAJ[VB[L@C;P>DL$DEL4HFLDL"
+	"G\\XQH](UI]8YJ]H]K-L^IM4XGLTPEL4HC[XAA[89@*\\2>*<*<9`#:9?[8H_R6X?J"
+	"4X#C2WC<0W'5.VG--&+&+%J^)U*U&$VR82MVKA!!G1%\"FQ!!EA!!DA!!C1!!B!!!"
+	"A!!!@!!!>Q!!=A%!<Q)#<2=(K;\"H```_`PX]````````````````````````````"
+	"``````````````````````````````````````\\^K;N>BK3_D;`BE,,DF<@KG,LN"
+	"H<`SI=0WJ=@[KMT`J=@[H<`SFLDLDL$DB[H=@[(5?*L.=*,&;9O_9)+V78OO58/G"
+	"3GS@1G38/VW1-V7),%[\"*5:Z(4ZR,#^:JA!!GA%#G1!!F!!!E!!!CQ!!BQ!!AA!!"
+	"@A!!?1!!>!%!=1)#<B5(K+.G```_````````````````````````````````````"
+	"`````````````````````````````````````P\\]````N,.BDK;ME\\8IF\\LPG\\XQ"
+	"I-,VJ-<ZK=P_J]H]I=0WG<POE<0GC;P?AK48?JT0=Z8);YX!:);Z8([R68?K47_C"
+	"2GC<0W'5.FC,,F#$*UF](U*V&TJOEQ=.H!%#GQ!!FA!!E1!!D1!!C!!!B!!!@Q!!"
+	"?Q!!>Q%\"=A!!=#1-M,.X`````@X]````````````````````````````````````"
+	"````````````````````````````````````````_`PX````TMS6G+?%G<D@H]0_"
+	"IM0UJMD\\K=P_J-<ZH,\\RF<@KD;`CB;@;@K$4>JD,<Z(%:YG]8Y'U7(KN5(+F37O?"
+	"17/7/FS0-F3(+ER`)U6Y&T^U=R1GI1!!H1!!G!!!EQ!!DQ!!CQ!!BA!!A1!!@1%!"
+	"?Q-$=QE#?EA@S>#E````_`PY````````````````````````````````````````"
+	"`````````````````````````````````````````````@X\\````\\/P6M,:WH,/K"
+	"K-X`KMP]J]DYH](UG,LNE,,FC+L>A;07?:P/=J4(;IS`9Y7Y7XWQ5X7I4'[B2';:"
+	"06_3.6?+,6#$+%>Z'U*W7S!\\K!!!HA!!GQ!!F1!!E1!!D!!!C!!!AQ)!A11$@Q5&"
+	"=31*F9*3[?\\<`````@X]````````````````````````````````````````````"
+	"`````````````````````````````````````````````````````````P\\^WNOQ"
+	"H[F=J]<KJ-D`G\\XNF,<HD+\\BB+<:@*\\2>:@+<9`#:IC\\8I#T6XGM4X'E3'K>1'+6"
+	"/6O/-6/'+UJ](U2X4CB*KQ!!I!!!H!!!FQ!!EQ!!DA!!C1%!B!)\"B11%?1A$<EQ6"
+	"S]?L`P`_````````````````````````````````````````````````````````"
+	"`````````````````````````````````````````````````````````P\\]````"
+	"```_R]>VI\\+#G,<7E,$=B[HA@[(8?*L/=:0';IO_9I3X7HSP5H3H3GS@1W79/VW1"
+	".&;*,%[\")5B^4CN.LA!!HA)$HA!!G1!!F1!!EA!!D1!!B11\"@AI$=D]9I[:Y```_"
+	"`P\\_`@X]````````````````````````````````````````````````````````"
+	"`````````````````````````````````````````````````````````````P\\^"
+	"`@X]````_0@KUN#&M<S3E;G?BK'P=J8*:YL-9I<#8(_W6XGL58+C37O<1'+4/6O-"
+	"-&3')U_$83N)M!%\"I11&IA)#I11%H1!!E1!\"@QY#>BI&BFI\\J[S%]@<M`````0P["
+	"`P\\^````````````````````````````````````````````````````````````"
+	"````````````````````````````````````````````````````````````````"
+	"`````P\\]`````````@PS\\/O`UN;JM\\S'E[.UA:;';)7;4H'I07/G.VS>,F/6*UK-"
+	")5#\"=1UOKA!!I!!!HA!!H2Q+A#!':C!#A6I\\KZO$T^<#^0PT`````````@X]````"
+	"````````````````````````````````````````````````````````````````"
+	"````````````````````````````````````````````````````````````````"
+	"`````````````````````````````PXV_PLN\\O`5X>_KU^3*QM:WK\\6NH;FDE[*A"
+	"L*>+T:)ZV+B1X]BP[N_/V][BX.D)\\O`K^PHV````````````````````````````"
+	"````````````````````````````````````````````````````````````````"
+	"";
@@ -1,68 +1,554 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-
-#include <chrono>
-#include <iostream>
-
-#include "IO/IO.h"
-#include "proc/proc.h"
-
-using namespace std;
-
-void benchmark() {
-
-	Image src;
-	Err e = Loader::instance().load("data/default.png", &src);
-	if (e != Err::Success) {
-		cout << "Problem" << endl;
-		return;
-	}
-	cout << "Loading Success!" << endl;
-
-	int dstW = src.w() * 2;
-	int dstH = src.h() * 2;
-
-	Image dst;
-	dst.setSize(dstW, dstH);
-
-	chrono::steady_clock c;
-
-	for (int i = 0; i < ScalerFactory::instance().typeCount(); i++) {
-		Scaler *scaler = ScalerFactory::instance().newScaler((ScalerType)i);
-
-		auto before = c.now();
-
-		const int benchCount = 100;
-		for (int i = 0; i < benchCount; i++) {
-			scaler->scale(src, dstW, dstH, &dst);
-		}
-
-		auto duration = c.now() - before;
-
-		// Display results
-		double milliseconds = chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
-		cout << ScalerFactory::instance().typeName(i) << "\t" << milliseconds << endl;
-
-		delete scaler;
-	}
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <math.h>
+#include <stdlib.h>
+
+#include "common/Cpu.h"
+#include "common/ThreadPool.h"
+#include "common/TiledImage.h"
+
+#include "IO/IO.h"
+#include "proc/proc.h"
+#include "proc/PatchDistance.h"
+#include "proc/ScalerDDT.h"
+#include "proc/ScalerEEP.h"
+#include "proc/ScalerSelfSim2x.h"
+
+using namespace std;
+
+// Checks one SIMD level of packRow against the scalar path, including out of range components
+template <typename T>
+static bool checkPackRow(SimdLevel level) {
+	const int n = 1000;
+	ImageChannelsT<T> c(n, 1);
+	for (int i = 0; i < n; i++) {
+		c.red[i] = (T)(rand() % 700 - 200);
+		c.green[i] = (T)(rand() % 700 - 200);
+		c.blue[i] = (T)(rand() % 700 - 200);
+	}
+
+	Image expected, actual;
+	expected.create(n, 1);
+	actual.create(n, 1);
+
+	setSimdLevel(SimdLevel::Scalar);
+	c.packRows(expected, 0, 1);
+	setSimdLevel(level);
+	c.packRows(actual, 0, 1);
+
+	return expected == actual;
+}
+
+// Times a full unpack and pack of src with the given plane type
+template <typename T>
+static double timeConversion(const Image &src, Image *dst) {
+	chrono::steady_clock c;
+	ImageChannelsT<T> planes(src.w(), src.h());
+
+	auto before = c.now();
+
+	const int benchCount = 100;
+	for (int i = 0; i < benchCount; i++) {
+		planes.unpackRows(src, 0, src.h());
+		planes.packRows(*dst, 0, src.h());
+	}
+
+	auto duration = c.now() - before;
+	return chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
+}
+
+static void benchmarkConversion(const Image &src) {
+	Image dst;
+	dst.setSizeDiscard(src.w(), src.h());
+
+	SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+
+	cout << "Image <-> planes\t8 bit\t16 bit\t32 bit" << endl;
+	for (SimdLevel level : levels) {
+		if (level > cpuSimdLevel()) {
+			continue;
+		}
+
+		setSimdLevel(level);
+
+		double t8 = timeConversion<uint8_t>(src, &dst);
+		bool ok = dst == src;
+		double t16 = timeConversion<int16_t>(src, &dst);
+		ok = ok && dst == src;
+		double t32 = timeConversion<lcomp>(src, &dst);
+		ok = ok && dst == src;
+
+		ok = ok && checkPackRow<int16_t>(level) && checkPackRow<lcomp>(level);
+
+		cout << simdLevelName(level) << "\t" << t8 << "\t" << t16 << "\t" << t32;
+		cout << (ok ? "" : "\t! differs from scalar") << endl;
+	}
+
+	setSimdLevel(cpuSimdLevel());
+}
+
+// Largest difference of any component between two images of the same size
+static int maxComponentDiff(const Image &a, const Image &b) {
+	if (a.w() != b.w() || a.h() != b.h()) {
+		return 256;
+	}
+
+	int ret = 0;
+	for (int i = 0; i < a.w() * a.h(); i++) {
+		pixel p = a.data()[i];
+		pixel q = b.data()[i];
+		ret = std::max(ret, abs(R(p) - R(q)));
+		ret = std::max(ret, abs(G(p) - G(q)));
+		ret = std::max(ret, abs(B(p) - B(q)));
+	}
+	return ret;
+}
+
+// Times a 2x scale at every SIMD level and checks each level against the scalar output
+static void benchmarkSimdLevels(const Image &src, ScalerType type, int tolerance) {
+	Scaler *scaler = ScalerFactory::instance().newScaler(type);
+
+	int dstW = src.w() * 2;
+	int dstH = src.h() * 2;
+
+	Image reference;
+	setSimdLevel(SimdLevel::Scalar);
+	scaler->scale(src, dstW, dstH, &reference);
+
+	SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::SSE41, SimdLevel::AVX2 };
+
+	chrono::steady_clock c;
+	Image dst;
+
+	for (SimdLevel level : levels) {
+		if (level > cpuSimdLevel()) {
+			continue;
+		}
+
+		setSimdLevel(level);
+
+		auto before = c.now();
+
+		const int benchCount = 20;
+		for (int i = 0; i < benchCount; i++) {
+			scaler->scale(src, dstW, dstH, &dst);
+		}
+
+		auto duration = c.now() - before;
+		double milliseconds = chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
+
+		int diff = maxComponentDiff(reference, dst);
+
+		cout << ScalerFactory::instance().typeName((int)type) << "\t" << simdLevelName(level) << "\t" << milliseconds;
+		cout << (diff <= tolerance ? "" : "\t! differs from scalar by " + to_string(diff)) << endl;
+	}
+
+	setSimdLevel(cpuSimdLevel());
+	delete scaler;
+}
+
+// Times a 2x scale at 1, 2, 4... threads and checks every result against the single-threaded one
+template <typename S>
+static void benchmarkThreads(const ConstImageView &src, const char *name, int benchCount) {
+	S scaler;
+
+	int dstW = src.w() * 2;
+	int dstH = src.h() * 2;
+
+	Image reference;
+	scaler.setThreadCount(1);
+	scaler.scale(src, dstW, dstH, &reference);
+
+	vector<int> counts;
+	int maxThreads = ThreadPool::instance().threadCount();
+	for (int n = 1; n < maxThreads; n *= 2) {
+		counts.push_back(n);
+	}
+	counts.push_back(maxThreads);
+
+	chrono::steady_clock c;
+	Image dst;
+	double single = 0;
+
+	for (int threads : counts) {
+		scaler.setThreadCount(threads);
+
+		auto before = c.now();
+
+		for (int i = 0; i < benchCount; i++) {
+			scaler.scale(src, dstW, dstH, &dst);
+		}
+
+		auto duration = c.now() - before;
+		double milliseconds = chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
+		if (threads == 1) {
+			single = milliseconds;
+		}
+
+		cout << name << "\t" << threads << " threads\t" << milliseconds << "\t" << single / milliseconds << "x";
+		cout << (dst == reference ? "" : "\t! differs from single-threaded") << endl;
+	}
+}
+
+// Times diffPatch() against diffPatchRow() at every SIMD level, a row of 6 candidates at a time as the SelfSim search uses them
+static void benchmarkPatchDistance(const Image &src) {
+	const int candidates = 6;
+	const int count = 100000;
+
+	ImageChannels8 small(src);
+	Image largeImage;
+	Scaler::scaleLinear(src, src.w() * 2, src.h() * 2, &largeImage);
+	ImageChannels8 large(largeImage);
+
+	const int half = PATCH_SIZE / 2;
+	if (small.w() < PATCH_SIZE + candidates || small.h() < PATCH_SIZE) {
+		return;
+	}
+
+	// random patch positions, all candidates inside the small image
+	vector<int> positions(4 * count);
+	for (int n = 0; n < count; n++) {
+		positions[4 * n] = half + rand() % (small.w() - PATCH_SIZE - candidates + 2);
+		positions[4 * n + 1] = half + rand() % (small.h() - PATCH_SIZE + 1);
+		positions[4 * n + 2] = half + rand() % (large.w() - PATCH_SIZE + 1);
+		positions[4 * n + 3] = half + rand() % (large.h() - PATCH_SIZE + 1);
+	}
+
+	vector<lcomp> reference(candidates * count);
+	vector<lcomp> result(candidates * count);
+
+	chrono::steady_clock c;
+
+	auto before = c.now();
+	for (int n = 0; n < count; n++) {
+		const int *p = &positions[4 * n];
+		for (int k = 0; k < candidates; k++) {
+			reference[candidates * n + k] = diffPatch(small, p[0] + k, p[1], large, p[2], p[3]);
+		}
+	}
+	auto duration = c.now() - before;
+	cout << "diffPatch\t\t" << chrono::duration<double, nano>(duration).count() / (count * candidates) << " ns" << endl;
+
+	SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::SSE41 };
+	for (SimdLevel level : levels) {
+		if (level > cpuSimdLevel()) {
+			continue;
+		}
+		setSimdLevel(level);
+
+		before = c.now();
+		for (int n = 0; n < count; n++) {
+			const int *p = &positions[4 * n];
+			diffPatchRow(small, p[0], p[1], large, p[2], p[3], candidates, &result[candidates * n]);
+		}
+		duration = c.now() - before;
+
+		cout << "diffPatchRow\t" << simdLevelName(level) << "\t" << chrono::duration<double, nano>(duration).count() / (count * candidates) << " ns";
+		cout << (result == reference ? "" : "\t! differs from diffPatch") << endl;
+	}
+
+	setSimdLevel(cpuSimdLevel());
+}
+
+// Peak signal-to-noise ratio of b against a, in dB, over all three components
+static double psnr(const Image &a, const Image &b) {
+	double sum = 0;
+	for (int i = 0; i < a.w() * a.h(); i++) {
+		pixel p = a.data()[i];
+		pixel q = b.data()[i];
+		for (int shift = 8; shift <= 24; shift += 8) {
+			double d = (double)((p >> shift) & 0xFF) - (double)((q >> shift) & 0xFF);
+			sum += d * d;
+		}
+	}
+	if (sum == 0) {
+		return INFINITY;
+	}
+	return 10.0 * log10(255.0 * 255.0 * 3.0 * a.w() * a.h() / sum);
+}
+
+// Times every SelfSim search method on a crop of src and checks it against the exhaustive search.
+// Quality is the PSNR of the crop restored from a half-size copy of itself.
+static void benchmarkSelfSimSearch(const Image &src) {
+	ConstImageView view = ConstImageView(src).sub(0, 0, std::min(src.w(), 320), std::min(src.h(), 240));
+
+	Image original, halved;
+	original.create(view.w(), view.h());
+	copyPixels(view, original);
+	Scaler::scaleLinear(original, original.w() / 2, original.h() / 2, &halved);
+
+	ScalerSelfSim2x scaler;
+	scaler.setSearch(ScalerSelfSim2x::Search::Exhaustive);
+
+	Image reference;
+	scaler.scale(view, view.w() * 2, view.h() * 2, &reference);
+
+	// PatchMatch and Hierarchical are approximate and only compared by quality
+	struct {
+		ScalerSelfSim2x::Search search;
+		int iterations;
+		// PatchMatch radius, or the coarse radius of Hierarchical
+		int radius;
+		int refineRadius;
+		const char *name;
+	} methods[] = {
+		{ ScalerSelfSim2x::Search::Exhaustive, 0, 0, 0, "Exhaustive" },
+		{ ScalerSelfSim2x::Search::AllOffsets, 0, 0, 0, "AllOffsets" },
+		{ ScalerSelfSim2x::Search::PatchMatch, 1, 3, 0, "PatchMatch 1x r3" },
+		{ ScalerSelfSim2x::Search::PatchMatch, 2, 3, 0, "PatchMatch 2x r3" },
+		{ ScalerSelfSim2x::Search::PatchMatch, 4, 3, 0, "PatchMatch 4x r3" },
+		{ ScalerSelfSim2x::Search::PatchMatch, 4, 16, 0, "PatchMatch 4x r16" },
+		{ ScalerSelfSim2x::Search::Hierarchical, 0, 4, 1, "Hierarchical r4/1" },
+		{ ScalerSelfSim2x::Search::Hierarchical, 0, 8, 1, "Hierarchical r8/1" },
+		{ ScalerSelfSim2x::Search::Hierarchical, 0, 8, 2, "Hierarchical r8/2" },
+		{ ScalerSelfSim2x::Search::Hierarchical, 0, 16, 1, "Hierarchical r16/1" },
+	};
+
+	chrono::steady_clock c;
+	Image dst;
+
+	for (auto &m : methods) {
+		scaler.setSearch(m.search);
+		if (m.search == ScalerSelfSim2x::Search::PatchMatch) {
+			scaler.setPatchMatchIterations(m.iterations);
+			scaler.setPatchMatchRadius(m.radius);
+		}
+		if (m.search == ScalerSelfSim2x::Search::Hierarchical) {
+			scaler.setRefineRadius(m.refineRadius);
+			scaler.setCoarseRadius(m.radius);
+		}
+
+		auto before = c.now();
+
+		const int benchCount = 5;
+		for (int i = 0; i < benchCount; i++) {
+			scaler.scale(view, view.w() * 2, view.h() * 2, &dst);
+		}
+
+		auto duration = c.now() - before;
+		double milliseconds = chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
+
+		bool exact = m.search == ScalerSelfSim2x::Search::Exhaustive || m.search == ScalerSelfSim2x::Search::AllOffsets;
+
+		Image restored;
+		scaler.scale(halved, original.w(), original.h(), &restored);
+
+		cout << "SelfSim\t" << m.name << "\t" << milliseconds << "\t" << psnr(original, restored) << " dB";
+		cout << (exact && !(dst == reference) ? "\t! differs from exhaustive search" : "") << endl;
+	}
+}
+
+// Runs every scaler type from many threads at once on one shared instance; every result must match a single-threaded run
+static void stressSharedScalers(const Image &src) {
+	// a crop keeps the slower scalers quick
+	ConstImageView view = ConstImageView(src).sub(0, 0, std::min(src.w(), 160), std::min(src.h(), 120));
+
+	int threadCount = std::max(8, (int)thread::hardware_concurrency() * 2);
+	const int rounds = 4;
+
+	for (int t = 0; t < ScalerFactory::instance().typeCount(); t++) {
+		Scaler *scaler = ScalerFactory::instance().newScaler((ScalerType)t);
+
+		// threads alternate between two factors, so calls of different sizes overlap
+		Image expected[2];
+		scaler->scale(view, view.w() * 2, view.h() * 2, &expected[0]);
+		scaler->scale(view, view.w() * 3, view.h() * 3, &expected[1]);
+
+		atomic<int> mismatches(0);
+		vector<thread> threads;
+		for (int k = 0; k < threadCount; k++) {
+			threads.emplace_back([&, k]() {
+				const Image &ref = expected[k % 2];
+				Image dst;
+				for (int r = 0; r < rounds; r++) {
+					Err e = scaler->scale(view, ref.w(), ref.h(), &dst);
+					if (e != Err::Success || !(dst == ref)) {
+						mismatches++;
+					}
+				}
+			});
+		}
+		for (thread &th : threads) {
+			th.join();
+		}
+
+		cout << ScalerFactory::instance().typeName(t) << "\t" << threadCount << " threads\t";
+		cout << (mismatches == 0 ? "ok" : "! " + to_string(mismatches) + " results differ") << endl;
+
+		delete scaler;
+	}
+}
+
+// Repeats src side by side and top to bottom until it fills w x h pixels
+static Image repeatImage(const Image &src, int w, int h) {
+	Image img;
+	img.setSizeDiscard(w, h);
+	ImageView view(img);
+	for (int y = 0; y < h; y += src.h()) {
+		for (int x = 0; x < w; x += src.w()) {
+			copyPixels(src, view.sub(x, y, std::min(src.w(), w - x), std::min(src.h(), h - y)));
+		}
+	}
+	return img;
+}
+
+// Times a single-threaded 2x scale of src as a whole and a tile at a time from a
+// TiledImage whose apron is border pixels, to see whether the tiled layout pays off
+template <typename S>
+static void benchmarkTiledLayout(const Image &src, const char *name, int border, int benchCount) {
+	S scaler;
+	scaler.setThreadCount(1);
+
+	chrono::steady_clock c;
+	Image dst, tmp;
+
+	for (int tileSize : { 0, 64, 128, 256 }) {
+		auto before = c.now();
+
+		for (int i = 0; i < benchCount; i++) {
+			if (tileSize == 0) {
+				scaler.scale(src, src.w() * 2, src.h() * 2, &dst);
+				continue;
+			}
+
+			dst.setSizeDiscard(src.w() * 2, src.h() * 2);
+			ImageView out(dst);
+
+			TiledImage tiled(src, tileSize, border);
+			for (const TiledImage::Tile &t : tiled) {
+				scaler.scale(t.area, t.area.w() * 2, t.area.h() * 2, &tmp);
+				copyPixels(ConstImageView(tmp).sub(t.areaX * 2, t.areaY * 2, t.view.w() * 2, t.view.h() * 2),
+					out.sub(t.x * 2, t.y * 2, t.view.w() * 2, t.view.h() * 2));
+			}
+		}
+
+		auto duration = c.now() - before;
+		double milliseconds = chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
+
+		cout << name << "\t" << src.w() << "x" << src.h() << "\t";
+		cout << (tileSize == 0 ? "row-major" : to_string(tileSize) + " px tiles") << "\t" << milliseconds << endl;
+	}
+}
+
+// Times a scale by factor with the fused cascade off and at its default tile size,
+// and checks that both give the same result
+template <typename S>
+static void benchmarkFused(const Image &src, const char *name, int factor) {
+	S scaler;
+	int tileSize = scaler.fusedTileSize();
+
+	int dstW = src.w() * factor;
+	int dstH = src.h() * factor;
+
+	chrono::steady_clock c;
+	Image reference, dst;
+
+	scaler.setFusedTileSize(0);
+	auto before = c.now();
+	scaler.scale(src, dstW, dstH, &reference);
+	double unfused = chrono::duration<double, milli>(c.now() - before).count();
+
+	scaler.setFusedTileSize(tileSize);
+	before = c.now();
+	scaler.scale(src, dstW, dstH, &dst);
+	double fused = chrono::duration<double, milli>(c.now() - before).count();
+
+	cout << name << "\t" << factor << "x\tunfused " << unfused << "\tfused " << fused;
+	cout << (dst == reference ? "" : "\t! fused result differs") << endl;
+}
+
+static bool loadBenchmarkImage(Image *src) {
+	Err e = Loader::instance().load("data/default.png", src);
+	if (e != Err::Success) {
+		cout << "Problem" << endl;
+		return false;
+	}
+	cout << "Loading Success!" << endl;
+	return true;
+}
+
+void benchmarkExtended() {
+
+	Image src;
+	if (!loadBenchmarkImage(&src)) {
+		return;
+	}
+
+	benchmarkThreads<ScalerSelfSim2x>(ConstImageView(src).sub(0, 0, std::min(src.w(), 320), std::min(src.h(), 240)),
+		"SelfSim", 5);
+	benchmarkSelfSimSearch(src);
+	stressSharedScalers(src);
+	benchmarkTiledLayout<ScalerDDT>(repeatImage(src, 8192, 1024), "DDT", 2, 3);
+	benchmarkTiledLayout<ScalerSelfSim2x>(repeatImage(src, 8192, 128), "SelfSim", 16, 1);
+	benchmarkFused<ScalerEEP>(repeatImage(src, 640, 240), "EEP", 8);
+	benchmarkFused<ScalerSelfSim2x>(repeatImage(src, 640, 240), "SelfSim", 4);
+}
+
+void benchmark() {
+
+	Image src;
+	if (!loadBenchmarkImage(&src)) {
+		return;
+	}
+
+	int dstW = src.w() * 2;
+	int dstH = src.h() * 2;
+
+	Image dst;
+	dst.setSize(dstW, dstH);
+
+	benchmarkConversion(src);
+	benchmarkSimdLevels(src, ScalerType::EEP, 1);
+	benchmarkSimdLevels(src, ScalerType::DDT, 1);
+	benchmarkThreads<ScalerDDT>(src, "DDT", 20);
+	benchmarkPatchDistance(src);
+
+	chrono::steady_clock c;
+
+	for (int i = 0; i < ScalerFactory::instance().typeCount(); i++) {
+		Scaler *scaler = ScalerFactory::instance().newScaler((ScalerType)i);
+
+		auto before = c.now();
+
+		const int benchCount = 100;
+		for (int i = 0; i < benchCount; i++) {
+			scaler->scale(src, dstW, dstH, &dst);
+		}
+
+		auto duration = c.now() - before;
+
+		// Display results
+		double milliseconds = chrono::duration<double, nano>(duration).count() / (benchCount * 1000000.0);
+		cout << ScalerFactory::instance().typeName(i) << "\t" << milliseconds << endl;
+
+		delete scaler;
+	}
 }
\ No newline at end of file
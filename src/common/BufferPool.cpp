@@ -0,0 +1,128 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <stdlib.h>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+#include "BufferPool.h"
+
+static void *alignedAlloc(size_t bytes) {
+#ifdef _MSC_VER
+	return _aligned_malloc(bytes, BufferPool::ALIGNMENT);
+#else
+	void *p = nullptr;
+	if (posix_memalign(&p, BufferPool::ALIGNMENT, bytes) != 0) {
+		return nullptr;
+	}
+	return p;
+#endif
+}
+
+static void alignedFree(void *p) {
+#ifdef _MSC_VER
+	_aligned_free(p);
+#else
+	free(p);
+#endif
+}
+
+// Rounds bytes up to its size class: 64 bytes minimum, then four classes per power of two
+// (2^k, 1.25 * 2^k, 1.5 * 2^k, 1.75 * 2^k), which bounds the waste to 25%.
+static size_t sizeClass(size_t bytes, int *bucket) {
+	int k = 6;
+	while (((size_t)1 << (k + 1)) < bytes) {
+		k++;
+	}
+
+	size_t base = (size_t)1 << k;
+	size_t step = base / 4;
+	size_t sub = bytes > base ? (bytes - base + step - 1) / step : 0;
+
+	*bucket = (k - 6) * 4 + (int)sub;
+	return base + sub * step;
+}
+
+BufferPool &BufferPool::instance() {
+	// Never destroyed, so that buffers released during static destruction still have a home
+	static BufferPool *inst = new BufferPool();
+	return *inst;
+}
+
+BufferPool::BufferPool() : mCachedBytes(0) {
+
+}
+
+BufferPool::~BufferPool() {
+	trim();
+}
+
+void *BufferPool::acquire(size_t bytes) {
+	int bucket;
+	size_t size = sizeClass(bytes, &bucket);
+
+	if (bucket < BUCKET_COUNT) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::vector<void*> &list = mFree[bucket];
+		if (!list.empty()) {
+			void *p = list.back();
+			list.pop_back();
+			mCachedBytes -= size;
+			return p;
+		}
+	}
+
+	return alignedAlloc(size);
+}
+
+void BufferPool::release(void *p, size_t bytes) {
+	if (p == nullptr) {
+		return;
+	}
+
+	int bucket;
+	size_t size = sizeClass(bytes, &bucket);
+
+	if (bucket < BUCKET_COUNT) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::vector<void*> &list = mFree[bucket];
+		if ((int)list.size() < MAX_CACHED_PER_BUCKET && mCachedBytes + size <= MAX_CACHED_BYTES) {
+			list.push_back(p);
+			mCachedBytes += size;
+			return;
+		}
+	}
+
+	alignedFree(p);
+}
+
+void BufferPool::trim() {
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		for (void *p : mFree[i]) {
+			alignedFree(p);
+		}
+		mFree[i].clear();
+	}
+	mCachedBytes = 0;
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __BUFFER_POOL_H__
+#define __BUFFER_POOL_H__
+
+#include <stddef.h>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+/*!
+\brief Process-wide cache of 64-byte aligned buffers.
+Requests are rounded up to one of four size classes per power of two and
+released buffers are kept for reuse, so images that are created and destroyed
+over and over (scaler temporaries, per-level intermediates) stop costing a trip
+to the OS and the page faults that come with it. Buffers are handed out
+uninitialised. The cache holds at most MAX_CACHED_BYTES; buffers that do not
+fit are freed on release.
+*/
+class BufferPool {
+public:
+	static BufferPool &instance();
+
+	static const size_t ALIGNMENT = 64;
+
+	/*!
+	\brief Returns an aligned buffer of at least the given size, or nullptr if out of memory.
+	*/
+	void *acquire(size_t bytes);
+
+	/*!
+	\brief Gives back a buffer obtained from acquire(). bytes must be the size it was acquired with.
+	*/
+	void release(void *p, size_t bytes);
+
+	/*!
+	\brief Frees every cached buffer. Call it when the working image size changes,
+	since buffers cached for the old size are unlikely to be reused.
+	*/
+	void trim();
+
+protected:
+	BufferPool();
+	virtual ~BufferPool();
+
+private:
+	static const int BUCKET_COUNT = 4 * 48;
+	static const int MAX_CACHED_PER_BUCKET = 4;
+	static const size_t MAX_CACHED_BYTES = (size_t)256 << 20;
+
+	std::mutex mMutex;
+	std::vector<void*> mFree[BUCKET_COUNT];
+	size_t mCachedBytes;
+};
+
+/*!
+\brief STL allocator drawing from BufferPool.
+resize() leaves trivially constructible elements uninitialised instead of
+zero-filling them; pass a value to resize() when zeroes are wanted.
+*/
+template <typename T>
+class PoolAllocator {
+public:
+	typedef T value_type;
+
+	template <typename U>
+	struct rebind {
+		typedef PoolAllocator<U> other;
+	};
+
+	PoolAllocator() {}
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U> &) {}
+
+	T *allocate(size_t n) {
+		void *p = BufferPool::instance().acquire(n * sizeof(T));
+		if (p == nullptr) {
+			throw std::bad_alloc();
+		}
+		return (T*)p;
+	}
+
+	void deallocate(T *p, size_t n) {
+		BufferPool::instance().release(p, n * sizeof(T));
+	}
+
+	// default-initialise: no memset for plain pixel and component types
+	template <typename U>
+	void construct(U *p) {
+		::new((void*)p) U;
+	}
+
+	template <typename U, typename... Args>
+	void construct(U *p, Args&&... args) {
+		::new((void*)p) U(std::forward<Args>(args)...);
+	}
+};
+
+template <typename T, typename U>
+inline bool operator == (const PoolAllocator<T> &, const PoolAllocator<U> &) {
+	return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const PoolAllocator<T> &, const PoolAllocator<U> &) {
+	return false;
+}
+
+#endif // ndef __BUFFER_POOL_H__
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+
+#ifdef UPSCALE_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#include "Cpu.h"
+
+static SimdLevel detectSimdLevel() {
+#if !defined(UPSCALE_X86)
+	return SimdLevel::Scalar;
+#elif defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool sse2 = (info[3] & (1 << 26)) != 0;
+	bool sse41 = (info[2] & (1 << 19)) != 0;
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+
+	// the OS must save the upper halves of the ymm registers
+	bool ymmState = osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+
+	bool avx2 = false;
+	if (maxLeaf >= 7 && ymmState) {
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+
+	if (avx2) return SimdLevel::AVX2;
+	if (sse41) return SimdLevel::SSE41;
+	if (sse2) return SimdLevel::SSE2;
+	return SimdLevel::Scalar;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+	if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+	if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+	return SimdLevel::Scalar;
+#endif
+}
+
+static std::atomic<int> &activeLevel() {
+	static std::atomic<int> level((int)cpuSimdLevel());
+	return level;
+}
+
+SimdLevel cpuSimdLevel() {
+	static const SimdLevel detected = detectSimdLevel();
+	return detected;
+}
+
+SimdLevel simdLevel() {
+	return (SimdLevel)activeLevel().load(std::memory_order_relaxed);
+}
+
+void setSimdLevel(SimdLevel cap) {
+	int level = std::min((int)cap, (int)cpuSimdLevel());
+	activeLevel().store(level, std::memory_order_relaxed);
+}
+
+const char *simdLevelName(SimdLevel level) {
+	switch (level) {
+	case SimdLevel::SSE2:
+		return "SSE2";
+	case SimdLevel::SSE41:
+		return "SSE4.1";
+	case SimdLevel::AVX2:
+		return "AVX2";
+	default:
+		return "Scalar";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __CPU_H__
+#define __CPU_H__
+
+// x86 SIMD kernels are only compiled where the intrinsics exist
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define UPSCALE_X86 1
+#endif
+
+// Lets a single function use a wider instruction set than the rest of the build.
+// MSVC accepts any intrinsic without this, GCC and Clang need it per function.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TARGET_SSE2
+#define TARGET_SSE41
+#define TARGET_AVX2
+#else
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+/*!
+\brief Instruction set levels the SIMD kernels are written for, in increasing order.
+*/
+enum class SimdLevel {
+	Scalar = 0,
+	SSE2,
+	SSE41,
+	AVX2
+};
+
+/*!
+\brief Highest level the CPU and OS support. Detected once.
+*/
+SimdLevel cpuSimdLevel();
+
+/*!
+\brief Level the kernels dispatch on: the detected level, unless capped lower.
+*/
+SimdLevel simdLevel();
+
+/*!
+\brief Caps the level kernels may use, e.g. to time or check them against the
+scalar path. Levels above what the CPU supports are ignored.
+*/
+void setSimdLevel(SimdLevel cap);
+
+const char *simdLevelName(SimdLevel level);
+
+#endif // ndef __CPU_H__
\ No newline at end of file
@@ -1,110 +1,220 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#include <algorithm>
-
-#include "Image.h"
-#include "ImageChannels.h"
-
-Image::Image() : mW(0), mH(0) {
-
-}
-
-Image::Image(const ImageChannels &imgc) {
-	mW = imgc.w();
-	mH = imgc.h();
-	pixels.resize(imgc.red.size());
-
-	for (int i = 0; i < pixels.size(); i++) {
-		comp r = lcompToComp(imgc.red[i]);
-		comp g = lcompToComp(imgc.green[i]);
-		comp b = lcompToComp(imgc.blue[i]);
-		pixels[i] = RGB(r, g, b);
-	}
-}
-
-Image::~Image() {
-
-}
-
-void Image::create(int w, int h) {
-	mW = w;
-	mH = h;
-	pixels.resize(mW * mH);
-	clear(0);
-}
-
-void Image::clear(color c) {
-	for (int j = 0; j < mH; j++) {
-		for (int i = 0; i < mW; i++) {
-			pixels.at(i + mW * j) = c;
-		}
-	}
-}
-
-void Image::setW(int newW) {
-	// tmp copy
-	Image tmp = *this;
-	mW = newW;
-	pixels.resize(w() * h());
-	copyFrom(tmp);
-}
-
-void Image::setH(int newH) {
-	// tmp copy
-	Image tmp = *this;
-	mH = newH;
-	pixels.resize(w() * h());
-	copyFrom(tmp);
-}
-
-void Image::setSize(int newW, int newH) {
-	// tmp copy
-	Image tmp = *this;
-	mW = newW;
-	mH = newH;
-	pixels.resize(w() * h());
-	copyFrom(tmp);
-}
-
-void Image::copyFrom(const Image &other) {
-	if (other.w() * other.h() <= 0) {
-		return;
-	}
-	for (int j = 0; j < h(); j++) {
-		for (int i = 0; i < w(); i++) {
-			setPixel(i, j, other.getPixel(i, j));
-		}
-	}
-}
-
-color Image::getPixel(int x, int y) const {
-	// clamp coordinates to border
-	x = std::max(0, std::min(w() - 1, x));
-	y = std::max(0, std::min(h() - 1, y));
-	return pixels.at(x + w() * y);
-}
-
-void Image::setPixel(int x, int y, color p) {
-	if (x < 0 || x >= w() || y < 0 || y >= h()) return;
-	pixels.at(x + w() * y) = p;
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+#include <string.h>
+#include <utility>
+
+#include "Image.h"
+#include "ImageChannels.h"
+
+Image::Image() : mW(0), mH(0) {
+
+}
+
+Image::Image(const ImageChannels &imgc) : mW(0), mH(0) {
+	setSizeDiscard(imgc.w(), imgc.h());
+
+	packChannels(imgc, ImageView(*this));
+}
+
+Image::Image(const Image &other) : mPixels(other.mPixels), mW(other.mW), mH(other.mH) {
+
+}
+
+Image::Image(Image &&other) noexcept : mPixels(std::move(other.mPixels)), mW(other.mW), mH(other.mH) {
+	other.mW = 0;
+	other.mH = 0;
+}
+
+Image::~Image() {
+
+}
+
+Image &Image::operator = (const Image &other) {
+	mPixels = other.mPixels;
+	mW = other.mW;
+	mH = other.mH;
+	return *this;
+}
+
+Image &Image::operator = (Image &&other) noexcept {
+	if (this != &other) {
+		mPixels = std::move(other.mPixels);
+		mW = other.mW;
+		mH = other.mH;
+		other.mPixels.reset();
+		other.mW = 0;
+		other.mH = 0;
+	}
+	return *this;
+}
+
+void Image::swap(Image &other) {
+	mPixels.swap(other.mPixels);
+	std::swap(mW, other.mW);
+	std::swap(mH, other.mH);
+}
+
+void Image::detach() {
+	if (!mPixels) {
+		mPixels = std::make_shared<PixelBuffer>();
+	} else if (mPixels.use_count() > 1) {
+		mPixels = std::make_shared<PixelBuffer>(*mPixels);
+	}
+}
+
+pixel *Image::data() {
+	detach();
+	return mPixels->data();
+}
+
+bool Image::operator == (const Image &other) const {
+	if (mW != other.mW || mH != other.mH) {
+		return false;
+	}
+	if (sharesPixels(other) || mW * mH == 0) {
+		return true;
+	}
+	return memcmp(data(), other.data(), mW * mH * sizeof(pixel)) == 0;
+}
+
+void Image::reserve(int pixelCount) {
+	detach();
+	mPixels->reserve(pixelCount);
+}
+
+void Image::create(int w, int h) {
+	setSizeDiscard(w, h);
+	clear(0);
+}
+
+void Image::clear(color c) {
+	std::fill_n(data(), mW * mH, c);
+}
+
+void Image::setW(int newW) {
+	setSize(newW, mH);
+}
+
+void Image::setH(int newH) {
+	setSize(mW, newH);
+}
+
+void Image::setSizeDiscard(int newW, int newH) {
+	mW = std::max(0, newW);
+	mH = std::max(0, newH);
+
+	// The contents are not needed, so a shared buffer is let go rather than copied
+	if (mPixels && mPixels.use_count() > 1) {
+		mPixels.reset();
+	}
+	detach();
+
+	// Shrinking keeps the capacity, so going back up does not reallocate
+	mPixels->resize(mW * mH);
+}
+
+void Image::setSize(int newW, int newH) {
+	newW = std::max(0, newW);
+	newH = std::max(0, newH);
+
+	int oldW = mW;
+	int oldH = mH;
+
+	// The pool hands out uninitialised memory; with nothing to stretch from, start black
+	if (oldW * oldH <= 0 || newW * newH <= 0) {
+		create(newW, newH);
+		return;
+	}
+
+	if (newW == oldW && newH == oldH) {
+		return;
+	}
+
+	// A shared buffer has to be copied anyway; copy straight into the new layout
+	if (mPixels.use_count() > 1) {
+		Image old(*this);
+		setSizeDiscard(newW, newH);
+		copyFrom(old);
+		return;
+	}
+
+	// Grow first (keeps the old rows at the front), re-lay rows in place, then trim
+	mPixels->resize(std::max(oldW * oldH, newW * newH));
+	pixel *base = mPixels->data();
+
+	int keptRows = std::min(oldH, newH);
+
+	if (newW <= oldW) {
+		// rows move towards the front: walk top to bottom
+		for (int j = 0; j < keptRows; j++) {
+			memmove(base + j * newW, base + j * oldW, newW * sizeof(pixel));
+		}
+	} else {
+		// rows move towards the back: walk bottom to top, then stretch the last column
+		for (int j = keptRows - 1; j >= 0; j--) {
+			pixel *row = base + j * newW;
+			memmove(row, base + j * oldW, oldW * sizeof(pixel));
+			std::fill(row + oldW, row + newW, row[oldW - 1]);
+		}
+	}
+
+	// new rows repeat the last one, as clamped reads of the old image would
+	for (int j = keptRows; j < newH; j++) {
+		memcpy(base + j * newW, base + (keptRows - 1) * newW, newW * sizeof(pixel));
+	}
+
+	mW = newW;
+	mH = newH;
+	mPixels->resize(mW * mH);
+}
+
+void Image::copyFrom(const Image &other) {
+	if (w() * h() <= 0 || other.w() * other.h() <= 0) {
+		return;
+	}
+
+	int copyW = std::min(w(), other.w());
+	pixel *dstPixels = data();
+
+	for (int j = 0; j < h(); j++) {
+		// clamp the source row to the border, like getPixel() does
+		const pixel *srcRow = other.data() + std::min(j, other.h() - 1) * other.w();
+		pixel *dstRow = dstPixels + j * w();
+
+		memcpy(dstRow, srcRow, copyW * sizeof(pixel));
+		std::fill(dstRow + copyW, dstRow + w(), srcRow[other.w() - 1]);
+	}
+}
+
+color Image::getPixel(int x, int y) const {
+	// clamp coordinates to border
+	x = std::max(0, std::min(w() - 1, x));
+	y = std::max(0, std::min(h() - 1, y));
+	return data()[x + w() * y];
+}
+
+void Image::setPixel(int x, int y, color p) {
+	if (x < 0 || x >= w() || y < 0 || y >= h()) return;
+	data()[x + w() * y] = p;
 }
\ No newline at end of file
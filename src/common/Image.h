@@ -1,115 +1,175 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#ifndef __IMAGE_H__
-#define __IMAGE_H__
-
-#include <stdint.h>
-#include <vector>
-#include <algorithm>
-
-// define our pixels as RGBA 32 bit
-typedef uint32_t pixel;
-typedef uint32_t color;
-
-// Define our pixel component as 8 bit unsigned integer
-typedef uint8_t comp;
-
-// define a larger component on which we can perform math
-typedef int lcomp;
-
-inline lcomp compToLcomp(comp c) {
-	return (lcomp)c;
-}
-
-inline comp lcompToComp(lcomp l) {
-	return (comp)std::max(0, std::min(255, (int)l));
-}
-
-inline comp R(pixel p) {
-	return (p >> 24) & 0xFF;
-}
-
-inline comp G(pixel p) {
-	return (p >> 16) & 0xFF;
-}
-
-inline comp B(pixel p) {
-	return (p >> 8) & 0xFF;
-}
-
-inline pixel RGB(comp r, comp g, comp b) {
-	return (r << 24) | (g << 16) | (b << 8);
-}
-
-inline int L(pixel p) {
-	return R(p) + G(p) + B(p);
-}
-
-class ImageChannels;
-
-class Image {
-public:
-	Image();
-	Image(const ImageChannels &imgc);
-	virtual ~Image();
-
-	std::vector<pixel> pixels;
-
-	void setW(int newW);
-	void setH(int newH);
-
-	void setSize(int newW, int newH);
-
-	int w() const { return mW; }
-	int h() const { return mH; }
-
-	/*!
-	\brief Creates a black image of the specified dimensions.
-	*/
-	void create(int w, int h);
-
-	/*!
-	\brief Clears with the given color.
-	*/
-	void clear(color c);
-
-	/*!
-	\brief Will read all available pixels from other.
-	*/
-	void copyFrom(const Image &other);
-
-	/*!
-	Checks bounds and returns black if outside image bounds.
-	*/
-	color getPixel(int x, int y) const;
-
-	/*!
-	Does bound checking.
-	*/
-	void setPixel(int x, int y, color p);
-
-private:
-	int mW, mH;
-};
-
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __IMAGE_H__
+#define __IMAGE_H__
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#include "BufferPool.h"
+
+// define our pixels as RGBA 32 bit
+typedef uint32_t pixel;
+typedef uint32_t color;
+
+// Define our pixel component as 8 bit unsigned integer
+typedef uint8_t comp;
+
+// define a larger component on which we can perform math
+typedef int lcomp;
+
+inline lcomp compToLcomp(comp c) {
+	return (lcomp)c;
+}
+
+inline comp lcompToComp(lcomp l) {
+	return (comp)std::max(0, std::min(255, (int)l));
+}
+
+inline comp R(pixel p) {
+	return (p >> 24) & 0xFF;
+}
+
+inline comp G(pixel p) {
+	return (p >> 16) & 0xFF;
+}
+
+inline comp B(pixel p) {
+	return (p >> 8) & 0xFF;
+}
+
+inline pixel RGB(comp r, comp g, comp b) {
+	return (r << 24) | (g << 16) | (b << 8);
+}
+
+inline int L(pixel p) {
+	return R(p) + G(p) + B(p);
+}
+
+typedef std::vector<pixel, PoolAllocator<pixel> > PixelBuffer;
+
+template <typename T>
+class ImageChannelsT;
+typedef ImageChannelsT<lcomp> ImageChannels;
+
+/*!
+\brief Packed RGB image.
+Copies share their pixel buffer; the buffer is only duplicated when one of the
+sharing images is about to be modified (copy-on-write). Anything that hands out
+writable pixel memory - data(), ImageView - counts as a modification.
+*/
+class Image {
+public:
+	Image();
+	Image(const ImageChannels &imgc);
+	Image(const Image &other);
+	Image(Image &&other) noexcept;
+	virtual ~Image();
+
+	Image &operator = (const Image &other);
+	Image &operator = (Image &&other) noexcept;
+
+	/*!
+	\brief Exchanges contents with other without copying any pixels.
+	*/
+	void swap(Image &other);
+
+	/*!
+	\brief Makes sure resizing up to pixelCount pixels will not reallocate.
+	*/
+	void reserve(int pixelCount);
+
+	/*!
+	\brief Read-only pixel memory, w() * h() pixels row by row. Never copies.
+	*/
+	const pixel *data() const { return mPixels ? mPixels->data() : nullptr; }
+
+	/*!
+	\brief Writable pixel memory. Duplicates the buffer first if it is shared.
+	*/
+	pixel *data();
+
+	/*!
+	\brief Whether other currently shares this image's pixel buffer.
+	*/
+	bool sharesPixels(const Image &other) const { return mPixels && mPixels == other.mPixels; }
+
+	bool operator == (const Image &other) const;
+	bool operator != (const Image &other) const { return !(*this == other); }
+
+	void setW(int newW);
+	void setH(int newH);
+
+	/*!
+	\brief Resizes in place. Pixels outside the old area repeat the nearest old edge pixel.
+	*/
+	void setSize(int newW, int newH);
+
+	/*!
+	\brief Resizes without keeping or initialising any pixels.
+	For destinations whose every pixel is about to be overwritten. Only
+	reallocates when growing past the current capacity.
+	*/
+	void setSizeDiscard(int newW, int newH);
+
+	int w() const { return mW; }
+	int h() const { return mH; }
+
+	/*!
+	\brief Creates a black image of the specified dimensions.
+	*/
+	void create(int w, int h);
+
+	/*!
+	\brief Clears with the given color.
+	*/
+	void clear(color c);
+
+	/*!
+	\brief Will read all available pixels from other.
+	*/
+	void copyFrom(const Image &other);
+
+	/*!
+	Checks bounds and returns black if outside image bounds.
+	*/
+	color getPixel(int x, int y) const;
+
+	/*!
+	Does bound checking.
+	*/
+	void setPixel(int x, int y, color p);
+
+private:
+	/*!
+	\brief Makes sure the buffer exists and no other image refers to it.
+	*/
+	void detach();
+
+	std::shared_ptr<PixelBuffer> mPixels;
+	int mW, mH;
+};
+
 #endif // ndef __IMAGE_H__
\ No newline at end of file
@@ -1,111 +1,321 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#ifndef __IMAGE_CHANNELS_H__
-#define __IMAGE_CHANNELS_H__
-
-#include "image.h"
-
-class ImageChannels {
-public:
-	ImageChannels(int w, int h, lcomp v = 0);
-	ImageChannels(const Image &img);
-	ImageChannels(const ImageChannels &img);
-	virtual ~ImageChannels();
-
-	std::vector<lcomp> red, green, blue;
-
-public:
-	int w() const { return mW; }
-	int h() const { return mH; }
-
-	void operator += (lcomp v) {
-		for (int i = 0; i < (int)red.size(); i++) {
-			green[i] += v;
-			blue[i] += v;
-			red[i] += v;
-		}
-	}
-
-	void operator -= (lcomp  v) {
-		*this += -v;
-	}
-
-	void operator *= (lcomp v) {
-		for (int i = 0; i < (int)red.size(); i++) {
-			green[i] *= v;
-			blue[i] *= v;
-			red[i] *= v;
-		}
-	}
-
-	void operator /= (lcomp v) {
-		for (int i = 0; i < (int)red.size(); i++) {
-			green[i] /= v;
-			blue[i] /= v;
-			red[i] /= v;
-		}
-	}
-
-	void operator = (lcomp v) {
-		for (int i = 0; i < (int)red.size(); i++) {
-			green[i] = v;
-			blue[i] = v;
-			red[i] = v;
-		}
-	}
-
-private:
-	int mW, mH;
-};
-
-inline ImageChannels operator + (const ImageChannels &a, const ImageChannels &b) {
-	ImageChannels ret(a);
-	if (a.red.size() != b.red.size()) {
-		return ret;
-	}
-
-	for (int i = 0; i < (int)a.red.size(); i++) {
-		ret.red[i] = a.red[i] + b.red[i];
-		ret.green[i] = a.green[i] + b.green[i];
-		ret.blue[i] = a.blue[i] + b.blue[i];
-	}
-
-	return ret;
-}
-
-inline ImageChannels operator - (const ImageChannels &a, const ImageChannels &b) {
-	ImageChannels ret(a);
-	if (a.red.size() != b.red.size()) {
-		return ret;
-	}
-
-	for (int i = 0; i < (int)a.red.size(); i++) {
-		ret.red[i] = a.red[i] - b.red[i];
-		ret.green[i] = a.green[i] - b.green[i];
-		ret.blue[i] = a.blue[i] - b.blue[i];
-	}
-
-	return ret;
-}
-
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __IMAGE_CHANNELS_H__
+#define __IMAGE_CHANNELS_H__
+
+#include "image.h"
+#include "ImageView.h"
+#include "PixelConvert.h"
+
+template <typename T>
+class ImageChannelsT;
+
+// Full-range planes for general arithmetic
+typedef ImageChannelsT<lcomp> ImageChannels;
+// Signed residuals and small sums, at half the bandwidth
+typedef ImageChannelsT<int16_t> ImageChannels16;
+// Plain 8-bit components, at a quarter of the bandwidth
+typedef ImageChannelsT<uint8_t> ImageChannels8;
+
+/*!
+\brief Converts an lcomp to a plane element type, saturating where the type is narrower.
+*/
+template <typename T>
+inline T narrowComp(lcomp v) {
+	return (T)v;
+}
+
+template <>
+inline uint8_t narrowComp<uint8_t>(lcomp v) {
+	return lcompToComp(v);
+}
+
+template <>
+inline int16_t narrowComp<int16_t>(lcomp v) {
+	return (int16_t)std::max(-32768, std::min(32767, (int)v));
+}
+
+/*!
+\brief Base of lazily evaluated channel arithmetic.
+Writing a + b / 25 builds a small tree of these instead of temporaries; the whole
+tree is evaluated in one pass over all three planes when it is assigned to an
+ImageChannels or packed into an image. Every node provides w(), h() and
+r(i), g(i), b(i) for the i-th pixel.
+*/
+template <typename E>
+class ChannelExpr {
+public:
+	const E &self() const { return static_cast<const E &>(*this); }
+};
+
+// Real channel images are referenced, intermediate nodes are held by value
+template <typename E>
+struct ChannelOperand {
+	typedef const E type;
+};
+
+template <typename T>
+struct ChannelOperand<ImageChannelsT<T> > {
+	typedef const ImageChannelsT<T> &type;
+};
+
+struct ChannelAdd {
+	static lcomp apply(lcomp a, lcomp b) { return a + b; }
+};
+
+struct ChannelSub {
+	static lcomp apply(lcomp a, lcomp b) { return a - b; }
+};
+
+struct ChannelMul {
+	static lcomp apply(lcomp a, lcomp b) { return a * b; }
+};
+
+struct ChannelDiv {
+	static lcomp apply(lcomp a, lcomp b) { return a / b; }
+};
+
+template <typename A, typename B, typename Op>
+class ChannelBinaryExpr : public ChannelExpr<ChannelBinaryExpr<A, B, Op> > {
+public:
+	// Like the eager operators were, a size mismatch yields the left operand unchanged
+	ChannelBinaryExpr(const A &a, const B &b) : mA(a), mB(b), mMatch(a.w() == b.w() && a.h() == b.h()) {}
+
+	int w() const { return mA.w(); }
+	int h() const { return mA.h(); }
+
+	lcomp r(int i) const { return mMatch ? Op::apply(mA.r(i), mB.r(i)) : mA.r(i); }
+	lcomp g(int i) const { return mMatch ? Op::apply(mA.g(i), mB.g(i)) : mA.g(i); }
+	lcomp b(int i) const { return mMatch ? Op::apply(mA.b(i), mB.b(i)) : mA.b(i); }
+
+private:
+	typename ChannelOperand<A>::type mA;
+	typename ChannelOperand<B>::type mB;
+	bool mMatch;
+};
+
+template <typename A, typename Op>
+class ChannelScalarExpr : public ChannelExpr<ChannelScalarExpr<A, Op> > {
+public:
+	ChannelScalarExpr(const A &a, lcomp v) : mA(a), mV(v) {}
+
+	int w() const { return mA.w(); }
+	int h() const { return mA.h(); }
+
+	lcomp r(int i) const { return Op::apply(mA.r(i), mV); }
+	lcomp g(int i) const { return Op::apply(mA.g(i), mV); }
+	lcomp b(int i) const { return Op::apply(mA.b(i), mV); }
+
+private:
+	typename ChannelOperand<A>::type mA;
+	lcomp mV;
+};
+
+/*!
+\brief Planar red, green and blue components with element type T.
+Math on elements is done in lcomp; results are saturated to T when stored.
+*/
+template <typename T>
+class ImageChannelsT : public ChannelExpr<ImageChannelsT<T> > {
+public:
+	typedef T value_type;
+	typedef std::vector<T, PoolAllocator<T> > Buffer;
+
+	ImageChannelsT(int w, int h, lcomp v = 0);
+	ImageChannelsT(const ConstImageView &img);
+	ImageChannelsT(const ImageChannelsT &img);
+	ImageChannelsT(ImageChannelsT &&img) noexcept;
+	virtual ~ImageChannelsT();
+
+	ImageChannelsT &operator = (const ImageChannelsT &img);
+	ImageChannelsT &operator = (ImageChannelsT &&img) noexcept;
+
+	/*!
+	\brief Evaluates a channel expression in a single pass.
+	*/
+	template <typename E>
+	ImageChannelsT(const ChannelExpr<E> &expr) : mW(0), mH(0) {
+		*this = expr;
+	}
+
+	template <typename E>
+	ImageChannelsT &operator = (const ChannelExpr<E> &expr) {
+		const E &e = expr.self();
+		int w = e.w();
+		int h = e.h();
+		int n = w * h;
+
+		// Same-size assignment (the only way *this can appear in expr) never reallocates
+		red.resize(n);
+		green.resize(n);
+		blue.resize(n);
+
+		for (int i = 0; i < n; i++) {
+			T r = narrowComp<T>(e.r(i));
+			T g = narrowComp<T>(e.g(i));
+			T b = narrowComp<T>(e.b(i));
+			red[i] = r;
+			green[i] = g;
+			blue[i] = b;
+		}
+
+		mW = w;
+		mH = h;
+		return *this;
+	}
+
+	/*!
+	\brief Unpacks rows [y0, y1) of img into the same rows of the planes.
+	img must have the same size as the planes.
+	*/
+	void unpackRows(const ConstImageView &img, int y0, int y1) {
+		for (int y = y0; y < y1; y++) {
+			int i = y * mW;
+			unpackRow(img.row(y), mW, red.data() + i, green.data() + i, blue.data() + i);
+		}
+	}
+
+	/*!
+	\brief Packs rows [y0, y1) of the planes into the same rows of dst, clamping each component.
+	dst must have the same size as the planes.
+	*/
+	void packRows(const ImageView &dst, int y0, int y1) const {
+		for (int y = y0; y < y1; y++) {
+			int i = y * mW;
+			packRow(red.data() + i, green.data() + i, blue.data() + i, mW, dst.row(y));
+		}
+	}
+
+	Buffer red, green, blue;
+
+public:
+	int w() const { return mW; }
+	int h() const { return mH; }
+
+	// expression leaf access
+	lcomp r(int i) const { return (lcomp)red[i]; }
+	lcomp g(int i) const { return (lcomp)green[i]; }
+	lcomp b(int i) const { return (lcomp)blue[i]; }
+
+	void operator += (lcomp v) {
+		for (int i = 0; i < (int)red.size(); i++) {
+			green[i] = narrowComp<T>((lcomp)green[i] + v);
+			blue[i] = narrowComp<T>((lcomp)blue[i] + v);
+			red[i] = narrowComp<T>((lcomp)red[i] + v);
+		}
+	}
+
+	void operator -= (lcomp  v) {
+		*this += -v;
+	}
+
+	void operator *= (lcomp v) {
+		for (int i = 0; i < (int)red.size(); i++) {
+			green[i] = narrowComp<T>((lcomp)green[i] * v);
+			blue[i] = narrowComp<T>((lcomp)blue[i] * v);
+			red[i] = narrowComp<T>((lcomp)red[i] * v);
+		}
+	}
+
+	void operator /= (lcomp v) {
+		for (int i = 0; i < (int)red.size(); i++) {
+			green[i] = narrowComp<T>((lcomp)green[i] / v);
+			blue[i] = narrowComp<T>((lcomp)blue[i] / v);
+			red[i] = narrowComp<T>((lcomp)red[i] / v);
+		}
+	}
+
+	void operator = (lcomp v) {
+		T c = narrowComp<T>(v);
+		for (int i = 0; i < (int)red.size(); i++) {
+			green[i] = c;
+			blue[i] = c;
+			red[i] = c;
+		}
+	}
+
+private:
+	int mW, mH;
+};
+
+template <typename A, typename B>
+inline ChannelBinaryExpr<A, B, ChannelAdd> operator + (const ChannelExpr<A> &a, const ChannelExpr<B> &b) {
+	return ChannelBinaryExpr<A, B, ChannelAdd>(a.self(), b.self());
+}
+
+template <typename A, typename B>
+inline ChannelBinaryExpr<A, B, ChannelSub> operator - (const ChannelExpr<A> &a, const ChannelExpr<B> &b) {
+	return ChannelBinaryExpr<A, B, ChannelSub>(a.self(), b.self());
+}
+
+template <typename A>
+inline ChannelScalarExpr<A, ChannelAdd> operator + (const ChannelExpr<A> &a, lcomp v) {
+	return ChannelScalarExpr<A, ChannelAdd>(a.self(), v);
+}
+
+template <typename A>
+inline ChannelScalarExpr<A, ChannelSub> operator - (const ChannelExpr<A> &a, lcomp v) {
+	return ChannelScalarExpr<A, ChannelSub>(a.self(), v);
+}
+
+template <typename A>
+inline ChannelScalarExpr<A, ChannelMul> operator * (const ChannelExpr<A> &a, lcomp v) {
+	return ChannelScalarExpr<A, ChannelMul>(a.self(), v);
+}
+
+template <typename A>
+inline ChannelScalarExpr<A, ChannelDiv> operator / (const ChannelExpr<A> &a, lcomp v) {
+	return ChannelScalarExpr<A, ChannelDiv>(a.self(), v);
+}
+
+/*!
+\brief Evaluates a channel expression straight into packed pixels, clamping each component.
+dst must have the same dimensions as the expression.
+*/
+template <typename E>
+void packChannels(const ChannelExpr<E> &expr, const ImageView &dst) {
+	const E &e = expr.self();
+
+	// evaluate a row at a time, then interleave it with the SIMD packer
+	ImageChannels::Buffer r(e.w()), g(e.w()), b(e.w());
+
+	int i = 0;
+	for (int y = 0; y < e.h(); y++) {
+		for (int x = 0; x < e.w(); x++, i++) {
+			r[x] = e.r(i);
+			g[x] = e.g(i);
+			b[x] = e.b(i);
+		}
+		packRow(r.data(), g.data(), b.data(), e.w(), dst.row(y));
+	}
+}
+
+/*!
+\brief Packs plain channel images without evaluating them element by element.
+*/
+template <typename T>
+void packChannels(const ImageChannelsT<T> &img, const ImageView &dst) {
+	img.packRows(dst, 0, img.h());
+}
+
 #endif // ndef __IMAGE_CHANNELS_H__
\ No newline at end of file
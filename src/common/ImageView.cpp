@@ -0,0 +1,53 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "ImageView.h"
+
+ImageView::ImageView(Image &img) : mData(img.data()), mW(img.w()), mH(img.h()), mStride(img.w()) {
+
+}
+
+ImageView ImageView::sub(int x, int y, int w, int h) const {
+	return ImageView(row(y) + x, w, h, mStride);
+}
+
+ConstImageView::ConstImageView(const Image &img) : mData(img.data()), mW(img.w()), mH(img.h()), mStride(img.w()) {
+
+}
+
+ConstImageView ConstImageView::sub(int x, int y, int w, int h) const {
+	return ConstImageView(row(y) + x, w, h, mStride);
+}
+
+void copyPixels(const ConstImageView &src, const ImageView &dst) {
+	int w = std::min(src.w(), dst.w());
+	int h = std::min(src.h(), dst.h());
+	if (w <= 0 || h <= 0) {
+		return;
+	}
+
+	for (int j = 0; j < h; j++) {
+		memcpy(dst.row(j), src.row(j), w * sizeof(pixel));
+	}
+}
\ No newline at end of file
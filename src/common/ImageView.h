@@ -0,0 +1,107 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __IMAGE_VIEW_H__
+#define __IMAGE_VIEW_H__
+
+#include <stddef.h>
+
+#include "Image.h"
+
+/*!
+\brief Non-owning, writable window into pixel memory.
+Rows are stride() pixels apart, so a view can address a sub-rectangle of a
+larger image without copying it.
+*/
+class ImageView {
+public:
+	ImageView() : mData(nullptr), mW(0), mH(0), mStride(0) {}
+	ImageView(pixel *data, int w, int h, int stride) : mData(data), mW(w), mH(h), mStride(stride) {}
+	ImageView(Image &img);
+
+	int w() const { return mW; }
+	int h() const { return mH; }
+	int stride() const { return mStride; }
+
+	pixel *row(int y) const { return mData + (ptrdiff_t)y * mStride; }
+
+	/*!
+	\brief Returns a view of the given rectangle. The rectangle must lie inside this view.
+	*/
+	ImageView sub(int x, int y, int w, int h) const;
+
+	/*!
+	Does bound checking.
+	*/
+	void setPixel(int x, int y, color p) const {
+		if (x < 0 || x >= mW || y < 0 || y >= mH) return;
+		row(y)[x] = p;
+	}
+
+private:
+	pixel *mData;
+	int mW, mH;
+	int mStride;
+};
+
+/*!
+\brief Non-owning, read-only window into pixel memory.
+*/
+class ConstImageView {
+public:
+	ConstImageView() : mData(nullptr), mW(0), mH(0), mStride(0) {}
+	ConstImageView(const pixel *data, int w, int h, int stride) : mData(data), mW(w), mH(h), mStride(stride) {}
+	ConstImageView(const ImageView &v) : mData(v.row(0)), mW(v.w()), mH(v.h()), mStride(v.stride()) {}
+	ConstImageView(const Image &img);
+
+	int w() const { return mW; }
+	int h() const { return mH; }
+	int stride() const { return mStride; }
+
+	const pixel *row(int y) const { return mData + (ptrdiff_t)y * mStride; }
+
+	/*!
+	\brief Returns a view of the given rectangle. The rectangle must lie inside this view.
+	*/
+	ConstImageView sub(int x, int y, int w, int h) const;
+
+	/*!
+	Clamps coordinates to the view borders.
+	*/
+	color getPixel(int x, int y) const {
+		x = std::max(0, std::min(mW - 1, x));
+		y = std::max(0, std::min(mH - 1, y));
+		return row(y)[x];
+	}
+
+private:
+	const pixel *mData;
+	int mW, mH;
+	int mStride;
+};
+
+/*!
+\brief Copies the overlapping top-left area of src into dst, one row at a time.
+*/
+void copyPixels(const ConstImageView &src, const ImageView &dst);
+
+#endif // ndef __IMAGE_VIEW_H__
\ No newline at end of file
@@ -0,0 +1,298 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "PixelConvert.h"
+#include "Cpu.h"
+
+#ifdef UPSCALE_X86
+#include <immintrin.h>
+#endif
+
+// Pixels are R << 24 | G << 16 | B << 8, so in memory (little endian) the
+// bytes of each pixel are 0, B, G, R.
+
+template <typename T>
+static void unpackScalar(const pixel *src, int n, T *r, T *g, T *b) {
+	for (int i = 0; i < n; i++) {
+		r[i] = (T)R(src[i]);
+		g[i] = (T)G(src[i]);
+		b[i] = (T)B(src[i]);
+	}
+}
+
+template <typename T>
+static void packScalar(const T *r, const T *g, const T *b, int n, pixel *dst) {
+	for (int i = 0; i < n; i++) {
+		dst[i] = RGB(lcompToComp(r[i]), lcompToComp(g[i]), lcompToComp(b[i]));
+	}
+}
+
+#ifdef UPSCALE_X86
+
+// The SIMD kernels handle whole blocks and return how many elements they
+// converted; the scalar loop finishes the row.
+
+TARGET_SSE2 static inline void split(__m128i p, __m128i *r, __m128i *g, __m128i *b) {
+	const __m128i ff = _mm_set1_epi32(0xFF);
+	*r = _mm_srli_epi32(p, 24);
+	*g = _mm_and_si128(_mm_srli_epi32(p, 16), ff);
+	*b = _mm_and_si128(_mm_srli_epi32(p, 8), ff);
+}
+
+TARGET_SSE2 static int unpackSSE2(const pixel *src, int n, lcomp *r, lcomp *g, lcomp *b) {
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128i vr, vg, vb;
+		split(_mm_loadu_si128((const __m128i *)(src + i)), &vr, &vg, &vb);
+		_mm_storeu_si128((__m128i *)(r + i), vr);
+		_mm_storeu_si128((__m128i *)(g + i), vg);
+		_mm_storeu_si128((__m128i *)(b + i), vb);
+	}
+	return i;
+}
+
+TARGET_SSE2 static int unpackSSE2(const pixel *src, int n, int16_t *r, int16_t *g, int16_t *b) {
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m128i r0, g0, b0, r1, g1, b1;
+		split(_mm_loadu_si128((const __m128i *)(src + i)), &r0, &g0, &b0);
+		split(_mm_loadu_si128((const __m128i *)(src + i + 4)), &r1, &g1, &b1);
+		_mm_storeu_si128((__m128i *)(r + i), _mm_packs_epi32(r0, r1));
+		_mm_storeu_si128((__m128i *)(g + i), _mm_packs_epi32(g0, g1));
+		_mm_storeu_si128((__m128i *)(b + i), _mm_packs_epi32(b0, b1));
+	}
+	return i;
+}
+
+TARGET_SSE2 static int unpackSSE2(const pixel *src, int n, uint8_t *r, uint8_t *g, uint8_t *b) {
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i vr[4], vg[4], vb[4];
+		for (int k = 0; k < 4; k++) {
+			split(_mm_loadu_si128((const __m128i *)(src + i + 4 * k)), &vr[k], &vg[k], &vb[k]);
+		}
+		_mm_storeu_si128((__m128i *)(r + i), _mm_packus_epi16(_mm_packs_epi32(vr[0], vr[1]), _mm_packs_epi32(vr[2], vr[3])));
+		_mm_storeu_si128((__m128i *)(g + i), _mm_packus_epi16(_mm_packs_epi32(vg[0], vg[1]), _mm_packs_epi32(vg[2], vg[3])));
+		_mm_storeu_si128((__m128i *)(b + i), _mm_packus_epi16(_mm_packs_epi32(vb[0], vb[1]), _mm_packs_epi32(vb[2], vb[3])));
+	}
+	return i;
+}
+
+// Interleaves 16 red, green and blue bytes into 16 pixels
+TARGET_SSE2 static inline void interleave(__m128i r, __m128i g, __m128i b, pixel *dst) {
+	const __m128i zero = _mm_setzero_si128();
+
+	__m128i zbLo = _mm_unpacklo_epi8(zero, b);
+	__m128i zbHi = _mm_unpackhi_epi8(zero, b);
+	__m128i grLo = _mm_unpacklo_epi8(g, r);
+	__m128i grHi = _mm_unpackhi_epi8(g, r);
+
+	_mm_storeu_si128((__m128i *)(dst + 0), _mm_unpacklo_epi16(zbLo, grLo));
+	_mm_storeu_si128((__m128i *)(dst + 4), _mm_unpackhi_epi16(zbLo, grLo));
+	_mm_storeu_si128((__m128i *)(dst + 8), _mm_unpacklo_epi16(zbHi, grHi));
+	_mm_storeu_si128((__m128i *)(dst + 12), _mm_unpackhi_epi16(zbHi, grHi));
+}
+
+// Saturates 16 elements to bytes
+TARGET_SSE2 static inline __m128i narrow16(const uint8_t *p) {
+	return _mm_loadu_si128((const __m128i *)p);
+}
+
+TARGET_SSE2 static inline __m128i narrow16(const int16_t *p) {
+	return _mm_packus_epi16(_mm_loadu_si128((const __m128i *)p), _mm_loadu_si128((const __m128i *)(p + 8)));
+}
+
+TARGET_SSE2 static inline __m128i narrow16(const lcomp *p) {
+	__m128i lo = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)p), _mm_loadu_si128((const __m128i *)(p + 4)));
+	__m128i hi = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(p + 8)), _mm_loadu_si128((const __m128i *)(p + 12)));
+	return _mm_packus_epi16(lo, hi);
+}
+
+template <typename T>
+TARGET_SSE2 static int packSSE2(const T *r, const T *g, const T *b, int n, pixel *dst) {
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		interleave(narrow16(r + i), narrow16(g + i), narrow16(b + i), dst + i);
+	}
+	return i;
+}
+
+TARGET_AVX2 static inline void split(__m256i p, __m256i *r, __m256i *g, __m256i *b) {
+	const __m256i ff = _mm256_set1_epi32(0xFF);
+	*r = _mm256_srli_epi32(p, 24);
+	*g = _mm256_and_si256(_mm256_srli_epi32(p, 16), ff);
+	*b = _mm256_and_si256(_mm256_srli_epi32(p, 8), ff);
+}
+
+// AVX2 packs work within 128-bit lanes; these restore linear order afterwards
+TARGET_AVX2 static inline __m256i packs32To16(__m256i a, __m256i b) {
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+}
+
+TARGET_AVX2 static inline __m256i packs32To8(__m256i a, __m256i b, __m256i c, __m256i d) {
+	const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+	__m256i v = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+	return _mm256_permutevar8x32_epi32(v, order);
+}
+
+TARGET_AVX2 static int unpackAVX2(const pixel *src, int n, lcomp *r, lcomp *g, lcomp *b) {
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i vr, vg, vb;
+		split(_mm256_loadu_si256((const __m256i *)(src + i)), &vr, &vg, &vb);
+		_mm256_storeu_si256((__m256i *)(r + i), vr);
+		_mm256_storeu_si256((__m256i *)(g + i), vg);
+		_mm256_storeu_si256((__m256i *)(b + i), vb);
+	}
+	return i;
+}
+
+TARGET_AVX2 static int unpackAVX2(const pixel *src, int n, int16_t *r, int16_t *g, int16_t *b) {
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m256i r0, g0, b0, r1, g1, b1;
+		split(_mm256_loadu_si256((const __m256i *)(src + i)), &r0, &g0, &b0);
+		split(_mm256_loadu_si256((const __m256i *)(src + i + 8)), &r1, &g1, &b1);
+		_mm256_storeu_si256((__m256i *)(r + i), packs32To16(r0, r1));
+		_mm256_storeu_si256((__m256i *)(g + i), packs32To16(g0, g1));
+		_mm256_storeu_si256((__m256i *)(b + i), packs32To16(b0, b1));
+	}
+	return i;
+}
+
+TARGET_AVX2 static int unpackAVX2(const pixel *src, int n, uint8_t *r, uint8_t *g, uint8_t *b) {
+	int i = 0;
+	for (; i + 32 <= n; i += 32) {
+		__m256i vr[4], vg[4], vb[4];
+		for (int k = 0; k < 4; k++) {
+			split(_mm256_loadu_si256((const __m256i *)(src + i + 8 * k)), &vr[k], &vg[k], &vb[k]);
+		}
+		_mm256_storeu_si256((__m256i *)(r + i), packs32To8(vr[0], vr[1], vr[2], vr[3]));
+		_mm256_storeu_si256((__m256i *)(g + i), packs32To8(vg[0], vg[1], vg[2], vg[3]));
+		_mm256_storeu_si256((__m256i *)(b + i), packs32To8(vb[0], vb[1], vb[2], vb[3]));
+	}
+	return i;
+}
+
+// Interleaves 32 red, green and blue bytes into 32 pixels
+TARGET_AVX2 static inline void interleave(__m256i r, __m256i g, __m256i b, pixel *dst) {
+	const __m256i zero = _mm256_setzero_si256();
+
+	__m256i zbLo = _mm256_unpacklo_epi8(zero, b);
+	__m256i zbHi = _mm256_unpackhi_epi8(zero, b);
+	__m256i grLo = _mm256_unpacklo_epi8(g, r);
+	__m256i grHi = _mm256_unpackhi_epi8(g, r);
+
+	// each of these holds 4 pixels from the low lane and the matching 4 from the high lane
+	__m256i p0 = _mm256_unpacklo_epi16(zbLo, grLo);
+	__m256i p1 = _mm256_unpackhi_epi16(zbLo, grLo);
+	__m256i p2 = _mm256_unpacklo_epi16(zbHi, grHi);
+	__m256i p3 = _mm256_unpackhi_epi16(zbHi, grHi);
+
+	_mm256_storeu_si256((__m256i *)(dst + 0), _mm256_permute2x128_si256(p0, p1, 0x20));
+	_mm256_storeu_si256((__m256i *)(dst + 8), _mm256_permute2x128_si256(p2, p3, 0x20));
+	_mm256_storeu_si256((__m256i *)(dst + 16), _mm256_permute2x128_si256(p0, p1, 0x31));
+	_mm256_storeu_si256((__m256i *)(dst + 24), _mm256_permute2x128_si256(p2, p3, 0x31));
+}
+
+// Saturates 32 elements to bytes
+TARGET_AVX2 static inline __m256i narrow32(const uint8_t *p) {
+	return _mm256_loadu_si256((const __m256i *)p);
+}
+
+TARGET_AVX2 static inline __m256i narrow32(const int16_t *p) {
+	__m256i v = _mm256_packus_epi16(_mm256_loadu_si256((const __m256i *)p), _mm256_loadu_si256((const __m256i *)(p + 16)));
+	return _mm256_permute4x64_epi64(v, 0xD8);
+}
+
+TARGET_AVX2 static inline __m256i narrow32(const lcomp *p) {
+	return packs32To8(
+		_mm256_loadu_si256((const __m256i *)p), _mm256_loadu_si256((const __m256i *)(p + 8)),
+		_mm256_loadu_si256((const __m256i *)(p + 16)), _mm256_loadu_si256((const __m256i *)(p + 24)));
+}
+
+template <typename T>
+TARGET_AVX2 static int packAVX2(const T *r, const T *g, const T *b, int n, pixel *dst) {
+	int i = 0;
+	for (; i + 32 <= n; i += 32) {
+		interleave(narrow32(r + i), narrow32(g + i), narrow32(b + i), dst + i);
+	}
+	return i;
+}
+
+#endif // def UPSCALE_X86
+
+template <typename T>
+static void unpackDispatch(const pixel *src, int n, T *r, T *g, T *b) {
+	int done = 0;
+
+#ifdef UPSCALE_X86
+	SimdLevel level = simdLevel();
+	if (level >= SimdLevel::AVX2) {
+		done = unpackAVX2(src, n, r, g, b);
+	} else if (level >= SimdLevel::SSE2) {
+		done = unpackSSE2(src, n, r, g, b);
+	}
+#endif
+
+	unpackScalar(src + done, n - done, r + done, g + done, b + done);
+}
+
+template <typename T>
+static void packDispatch(const T *r, const T *g, const T *b, int n, pixel *dst) {
+	int done = 0;
+
+#ifdef UPSCALE_X86
+	SimdLevel level = simdLevel();
+	if (level >= SimdLevel::AVX2) {
+		done = packAVX2(r, g, b, n, dst);
+	} else if (level >= SimdLevel::SSE2) {
+		done = packSSE2(r, g, b, n, dst);
+	}
+#endif
+
+	packScalar(r + done, g + done, b + done, n - done, dst + done);
+}
+
+void unpackRow(const pixel *src, int n, uint8_t *r, uint8_t *g, uint8_t *b) {
+	unpackDispatch(src, n, r, g, b);
+}
+
+void unpackRow(const pixel *src, int n, int16_t *r, int16_t *g, int16_t *b) {
+	unpackDispatch(src, n, r, g, b);
+}
+
+void unpackRow(const pixel *src, int n, lcomp *r, lcomp *g, lcomp *b) {
+	unpackDispatch(src, n, r, g, b);
+}
+
+void packRow(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n, pixel *dst) {
+	packDispatch(r, g, b, n, dst);
+}
+
+void packRow(const int16_t *r, const int16_t *g, const int16_t *b, int n, pixel *dst) {
+	packDispatch(r, g, b, n, dst);
+}
+
+void packRow(const lcomp *r, const lcomp *g, const lcomp *b, int n, pixel *dst) {
+	packDispatch(r, g, b, n, dst);
+}
\ No newline at end of file
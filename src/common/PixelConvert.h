@@ -0,0 +1,46 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __PIXEL_CONVERT_H__
+#define __PIXEL_CONVERT_H__
+
+#include <stdint.h>
+
+#include "Image.h"
+
+/*!
+\brief Splits n packed pixels into red, green and blue planes.
+Uses the widest SIMD level allowed by simdLevel().
+*/
+void unpackRow(const pixel *src, int n, uint8_t *r, uint8_t *g, uint8_t *b);
+void unpackRow(const pixel *src, int n, int16_t *r, int16_t *g, int16_t *b);
+void unpackRow(const pixel *src, int n, lcomp *r, lcomp *g, lcomp *b);
+
+/*!
+\brief Interleaves n elements of red, green and blue planes into packed pixels,
+saturating each component to [0, 255] like lcompToComp().
+*/
+void packRow(const uint8_t *r, const uint8_t *g, const uint8_t *b, int n, pixel *dst);
+void packRow(const int16_t *r, const int16_t *g, const int16_t *b, int n, pixel *dst);
+void packRow(const lcomp *r, const lcomp *g, const lcomp *b, int n, pixel *dst);
+
+#endif // ndef __PIXEL_CONVERT_H__
\ No newline at end of file
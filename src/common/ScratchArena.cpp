@@ -0,0 +1,61 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <new>
+
+#include "BufferPool.h"
+#include "ScratchArena.h"
+
+ScratchArena::ScratchArena() {
+
+}
+
+ScratchArena::~ScratchArena() {
+	reset();
+}
+
+void *ScratchArena::allocBytes(size_t bytes, bool zero) {
+	if (bytes == 0) {
+		bytes = 1;
+	}
+
+	void *p = BufferPool::instance().acquire(bytes);
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	Block b = { p, bytes };
+	mBlocks.push_back(b);
+
+	if (zero) {
+		memset(p, 0, bytes);
+	}
+
+	return p;
+}
+
+void ScratchArena::reset() {
+	for (const Block &b : mBlocks) {
+		BufferPool::instance().release(b.p, b.bytes);
+	}
+	mBlocks.clear();
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __SCRATCH_ARENA_H__
+#define __SCRATCH_ARENA_H__
+
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+/*!
+\brief Hands out temporary planes from BufferPool and gives them all back at once.
+Meant for per-call scratch memory inside scalers: allocate freely while working,
+then reset() (or let the arena go out of scope) instead of tracking each buffer.
+Memory is uninitialised unless zero is requested.
+*/
+class ScratchArena {
+public:
+	ScratchArena();
+	virtual ~ScratchArena();
+
+	template <typename T>
+	T *alloc(size_t count, bool zero = false) {
+		return (T*)allocBytes(count * sizeof(T), zero);
+	}
+
+	/*!
+	\brief Returns every plane handed out so far to the pool.
+	*/
+	void reset();
+
+private:
+	ScratchArena(const ScratchArena &) = delete;
+	ScratchArena &operator = (const ScratchArena &) = delete;
+
+	void *allocBytes(size_t bytes, bool zero);
+
+	struct Block {
+		void *p;
+		size_t bytes;
+	};
+	std::vector<Block> mBlocks;
+};
+
+#endif // ndef __SCRATCH_ARENA_H__
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+#include <thread>
+
+#include "ThreadPool.h"
+
+ThreadPool &ThreadPool::instance() {
+	// Never destroyed: the workers sleep until the process ends rather than being joined during static destruction
+	static ThreadPool *inst = new ThreadPool();
+	return *inst;
+}
+
+ThreadPool::ThreadPool() {
+	mWorkerCount = std::max(0, (int)std::thread::hardware_concurrency() - 1);
+
+	for (int i = 0; i < mWorkerCount; i++) {
+		std::thread(&ThreadPool::work, this).detach();
+	}
+}
+
+ThreadPool::~ThreadPool() {
+
+}
+
+void ThreadPool::parallelFor(int count, int threadCount, const std::function<void(int)> &body) {
+	if (threadCount <= 0) {
+		threadCount = this->threadCount();
+	}
+	threadCount = std::min(std::min(threadCount, this->threadCount()), count);
+
+	if (threadCount <= 1) {
+		for (int i = 0; i < count; i++) {
+			body(i);
+		}
+		return;
+	}
+
+	Job job;
+	job.body = &body;
+	job.count = count;
+	job.next = 0;
+	job.helpers = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (int i = 1; i < threadCount; i++) {
+			mQueue.push_back(&job);
+		}
+	}
+	mWake.notify_all();
+
+	run(job);
+
+	// Every index has been claimed. Withdraw the entries no worker has picked up
+	// yet, then wait for the workers still busy with the last ones.
+	std::unique_lock<std::mutex> lock(mMutex);
+	mQueue.erase(std::remove(mQueue.begin(), mQueue.end(), &job), mQueue.end());
+	mDone.wait(lock, [&job] { return job.helpers == 0; });
+}
+
+void ThreadPool::run(Job &job) {
+	for (int i = job.next++; i < job.count; i = job.next++) {
+		(*job.body)(i);
+	}
+}
+
+void ThreadPool::work() {
+	std::unique_lock<std::mutex> lock(mMutex);
+	for (;;) {
+		mWake.wait(lock, [this] { return !mQueue.empty(); });
+
+		Job *job = mQueue.front();
+		mQueue.pop_front();
+		job->helpers++;
+
+		lock.unlock();
+		run(*job);
+		lock.lock();
+
+		if (--job->helpers == 0) {
+			mDone.notify_all();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/*!
+\brief Process-wide set of worker threads, one per hardware thread beyond the first.
+Any number of threads may call parallelFor() at the same time; their work is
+shared between the workers and the callers themselves, so a call never waits
+on a worker that is busy with something else.
+*/
+class ThreadPool {
+public:
+	static ThreadPool &instance();
+
+	/*!
+	\brief Worker threads plus the calling thread: the most a parallelFor() can use.
+	*/
+	int threadCount() const { return mWorkerCount + 1; }
+
+	/*!
+	\brief Calls body(i) once for every i in [0, count), on up to threadCount threads
+	(the calling one included; 0 means threadCount()), and returns when all calls are done.
+	Which thread runs which index is unspecified.
+	*/
+	void parallelFor(int count, int threadCount, const std::function<void(int)> &body);
+
+protected:
+	ThreadPool();
+	virtual ~ThreadPool();
+
+private:
+	struct Job {
+		const std::function<void(int)> *body;
+		int count;
+		std::atomic<int> next;
+		// workers inside run(); guarded by mMutex
+		int helpers;
+	};
+
+	static void run(Job &job);
+	void work();
+
+	int mWorkerCount;
+
+	std::mutex mMutex;
+	std::condition_variable mWake;
+	std::condition_variable mDone;
+	// one entry per worker a job asked for
+	std::deque<Job*> mQueue;
+};
+
+#endif // ndef __THREAD_POOL_H__
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include <string.h>
+
+#include "TiledImage.h"
+
+TiledImage::TiledImage() : mW(0), mH(0), mTileSize(0), mBorder(0), mTilesX(0), mTilesY(0) {
+
+}
+
+TiledImage::TiledImage(const ConstImageView &src, int tileSize, int border) : TiledImage() {
+	assign(src, tileSize, border);
+}
+
+TiledImage::~TiledImage() {
+
+}
+
+void TiledImage::assign(const ConstImageView &src, int tileSize, int border) {
+	mW = src.w();
+	mH = src.h();
+	mTileSize = std::max(1, tileSize);
+	mBorder = std::max(0, border);
+
+	mTiles.clear();
+
+	if (mW <= 0 || mH <= 0) {
+		mTilesX = mTilesY = 0;
+		mPixels.clear();
+		return;
+	}
+
+	mTilesX = (mW + mTileSize - 1) / mTileSize;
+	mTilesY = (mH + mTileSize - 1) / mTileSize;
+
+	// every tile gets a full-sized block, so blocks start at fixed offsets
+	int stride = mTileSize + 2 * mBorder;
+	int blockSize = stride * stride;
+	mPixels.resize((size_t)blockSize * mTilesX * mTilesY);
+	mTiles.reserve(mTilesX * mTilesY);
+
+	for (int ty = 0; ty < mTilesY; ty++) {
+		for (int tx = 0; tx < mTilesX; tx++) {
+			int x0 = tx * mTileSize;
+			int y0 = ty * mTileSize;
+			int tw = std::min(mTileSize, mW - x0);
+			int th = std::min(mTileSize, mH - y0);
+
+			pixel *block = mPixels.data() + (size_t)(ty * mTilesX + tx) * blockSize;
+			pixel *origin = block + mBorder * stride + mBorder;
+
+			// source columns covered by the apron, clamped to the image
+			int left = std::max(0, x0 - mBorder);
+			int right = std::min(mW, x0 + tw + mBorder);
+
+			for (int j = -mBorder; j < th + mBorder; j++) {
+				const pixel *srcRow = src.row(std::max(0, std::min(mH - 1, y0 + j)));
+				pixel *dstRow = origin + j * stride;
+
+				memcpy(dstRow + (left - x0), srcRow + left, (right - left) * sizeof(pixel));
+
+				// replicate the image edge where the apron sticks out of it
+				std::fill(dstRow - mBorder, dstRow + (left - x0), srcRow[0]);
+				std::fill(dstRow + (right - x0), dstRow + tw + mBorder, srcRow[mW - 1]);
+			}
+
+			int top = std::max(0, y0 - mBorder);
+			int bottom = std::min(mH, y0 + th + mBorder);
+
+			Tile t;
+			t.x = x0;
+			t.y = y0;
+			t.view = ConstImageView(origin, tw, th, stride);
+			t.areaX = x0 - left;
+			t.areaY = y0 - top;
+			t.area = ConstImageView(origin - t.areaY * stride - t.areaX, right - left, bottom - top, stride);
+			mTiles.push_back(t);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __TILED_IMAGE_H__
+#define __TILED_IMAGE_H__
+
+#include <vector>
+
+#include "Image.h"
+#include "ImageView.h"
+
+/*!
+\brief Copy of an image stored as independent square tiles.
+Each tile is kept in its own contiguous block together with an apron of
+border() pixels taken from its neighbours (or replicated at the image edges),
+so a kernel with a small 2D stencil can process one tile at a time without
+touching any other tile's memory. Row-major storage keeps vertical neighbours
+a few hundred bytes apart instead of a full image row, whatever the image width.
+*/
+class TiledImage {
+public:
+	/*!
+	\brief One tile. view covers the tile's own pixels and its rows may be read
+	up to border() pixels outside in every direction.
+	*/
+	struct Tile {
+		int x, y;
+		ConstImageView view;
+
+		// view grown by the apron except where that would leave the image, and the
+		// position of view inside it; a scaler given area sees the image's own edges
+		ConstImageView area;
+		int areaX, areaY;
+	};
+
+	typedef std::vector<Tile>::const_iterator const_iterator;
+
+	TiledImage();
+	TiledImage(const ConstImageView &src, int tileSize, int border);
+	virtual ~TiledImage();
+
+	/*!
+	\brief Copies src into tiles of tileSize x tileSize pixels (smaller at the
+	right and bottom edges) and fills the apron around each one.
+	*/
+	void assign(const ConstImageView &src, int tileSize, int border);
+
+	int w() const { return mW; }
+	int h() const { return mH; }
+	int tileSize() const { return mTileSize; }
+	int border() const { return mBorder; }
+
+	int tilesX() const { return mTilesX; }
+	int tilesY() const { return mTilesY; }
+	int tileCount() const { return (int)mTiles.size(); }
+
+	/*!
+	Unchecked.
+	*/
+	const Tile &tile(int tx, int ty) const { return mTiles[ty * mTilesX + tx]; }
+
+	const_iterator begin() const { return mTiles.begin(); }
+	const_iterator end() const { return mTiles.end(); }
+
+	/*!
+	Unchecked. Coordinates must lie inside the image.
+	*/
+	color at(int x, int y) const {
+		const Tile &t = tile(x / mTileSize, y / mTileSize);
+		return t.view.row(y - t.y)[x - t.x];
+	}
+
+private:
+	PixelBuffer mPixels;
+	std::vector<Tile> mTiles;
+	int mW, mH;
+	int mTileSize;
+	int mBorder;
+	int mTilesX, mTilesY;
+};
+
+#endif // ndef __TILED_IMAGE_H__
\ No newline at end of file
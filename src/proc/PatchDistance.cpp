@@ -0,0 +1,221 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "PatchDistance.h"
+#include "../common/Cpu.h"
+
+#ifdef UPSCALE_X86
+#include <immintrin.h>
+#endif
+
+/*
+The kernels get, per channel (three, or one for a single plane), the top-left
+corner of the first small patch and of the large patch. The small rows of all
+candidates together are PATCH_ROW_MAX + PATCH_SIZE - 1 bytes wide; the kernels
+load 16 bytes from each. The single-candidate kernel loads 8 bytes from every
+small and large row.
+*/
+struct PatchRows {
+	int channels;
+	const uint8_t *small[3];
+	int smallStride;
+	const uint8_t *large[3];
+	int largeStride;
+};
+
+#ifdef UPSCALE_X86
+
+static const int LOAD_BYTES = 16;
+// What the single-candidate kernel loads from each small and large row
+static const int ONE_LOAD_BYTES = 8;
+
+static inline int loadPatchBytes(const uint8_t *p) {
+	int v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+// Candidates in pairs: sad_epu8 sums the 5 masked bytes of each half
+TARGET_SSE2 static void diffPatchRowSSE2(const PatchRows &rows, lcomp *out) {
+	const __m128i mask = _mm_set_epi8(0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1);
+
+	__m128i acc[PATCH_ROW_MAX / 2];
+	for (int k = 0; k < PATCH_ROW_MAX / 2; k++) {
+		acc[k] = _mm_setzero_si128();
+	}
+
+	for (int c = 0; c < rows.channels; c++) {
+		for (int dy = 0; dy < PATCH_SIZE; dy++) {
+			const uint8_t *s = rows.small[c] + dy * rows.smallStride;
+			const uint8_t *l = rows.large[c] + dy * rows.largeStride;
+
+			__m128i large = _mm_loadl_epi64((const __m128i *)l);
+			large = _mm_and_si128(_mm_unpacklo_epi64(large, large), mask);
+
+			for (int k = 0; k < PATCH_ROW_MAX / 2; k++) {
+				__m128i pair = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(s + 2 * k)),
+					_mm_loadl_epi64((const __m128i *)(s + 2 * k + 1)));
+				acc[k] = _mm_add_epi32(acc[k], _mm_sad_epu8(_mm_and_si128(pair, mask), large));
+			}
+		}
+	}
+
+	for (int k = 0; k < PATCH_ROW_MAX / 2; k++) {
+		out[2 * k] = _mm_cvtsi128_si32(acc[k]);
+		out[2 * k + 1] = _mm_cvtsi128_si32(_mm_srli_si128(acc[k], 8));
+	}
+}
+
+// |a - b| of unsigned bytes
+TARGET_SSE2 static inline __m128i absDiff(__m128i a, __m128i b) {
+	return _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+}
+
+// mpsadbw gives the sums of 4 bytes at 8 consecutive offsets; the 5th column is added separately
+TARGET_SSE41 static void diffPatchRowSSE41(const PatchRows &rows, lcomp *out) {
+	const __m128i zero = _mm_setzero_si128();
+	__m128i acc = zero;
+
+	for (int c = 0; c < rows.channels; c++) {
+		for (int dy = 0; dy < PATCH_SIZE; dy++) {
+			const uint8_t *s = rows.small[c] + dy * rows.smallStride;
+			const uint8_t *l = rows.large[c] + dy * rows.largeStride;
+
+			__m128i small = _mm_loadu_si128((const __m128i *)s);
+			__m128i first4 = _mm_cvtsi32_si128(loadPatchBytes(l));
+			__m128i last = _mm_set1_epi8((char)l[4]);
+
+			acc = _mm_add_epi16(acc, _mm_mpsadbw_epu8(small, first4, 0));
+			acc = _mm_add_epi16(acc, _mm_unpacklo_epi8(absDiff(_mm_srli_si128(small, 4), last), zero));
+		}
+	}
+
+	// at most 3 * 25 * 255 per candidate, so 16 bits are enough
+	_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi16(acc, zero));
+	_mm_storeu_si128((__m128i *)(out + 4), _mm_unpackhi_epi16(acc, zero));
+}
+
+// A single candidate: two patch rows per register, the 5 masked bytes of each summed by sad_epu8
+TARGET_SSE2 static lcomp diffPatchOneSSE2(const PatchRows &rows) {
+	const __m128i mask = _mm_set_epi8(0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1);
+
+	__m128i acc = _mm_setzero_si128();
+	for (int c = 0; c < rows.channels; c++) {
+		for (int y = 0; y < PATCH_SIZE; y += 2) {
+			__m128i s = _mm_loadl_epi64((const __m128i *)(rows.small[c] + y * rows.smallStride));
+			__m128i l = _mm_loadl_epi64((const __m128i *)(rows.large[c] + y * rows.largeStride));
+			if (y + 1 < PATCH_SIZE) {
+				s = _mm_unpacklo_epi64(s, _mm_loadl_epi64((const __m128i *)(rows.small[c] + (y + 1) * rows.smallStride)));
+				l = _mm_unpacklo_epi64(l, _mm_loadl_epi64((const __m128i *)(rows.large[c] + (y + 1) * rows.largeStride)));
+			}
+			acc = _mm_add_epi32(acc, _mm_sad_epu8(_mm_and_si128(s, mask), _mm_and_si128(l, mask)));
+		}
+	}
+
+	return _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+}
+
+#endif // def UPSCALE_X86
+
+// diffPatchRow() on channels planes of each image, which are smallW x smallH and largeW x largeH bytes
+static void diffPatchRowPlanes(int channels, const uint8_t *const *small, int smallW, int smallH,
+	int smallPatchX, int smallPatchY, const uint8_t *const *large, int largeW, int largeH,
+	int largePatchX, int largePatchY, int count, lcomp *out) {
+
+	int smallFirst = (smallPatchX - PATCH_SIZE / 2) + smallW * (smallPatchY - PATCH_SIZE / 2);
+	int largeFirst = (largePatchX - PATCH_SIZE / 2) + largeW * (largePatchY - PATCH_SIZE / 2);
+
+#ifdef UPSCALE_X86
+	SimdLevel level = simdLevel();
+
+	// The kernels read LOAD_BYTES (or ONE_LOAD_BYTES) from the start of each small row and
+	// ONE_LOAD_BYTES from each large row; the last ones must not run off the planes
+	int smallLast = smallFirst + smallW * (PATCH_SIZE - 1);
+	int largeLast = largeFirst + largeW * (PATCH_SIZE - 1);
+
+	bool largeFits = largeLast + ONE_LOAD_BYTES <= largeW * largeH;
+	bool one = count == 1 && smallLast + ONE_LOAD_BYTES <= smallW * smallH;
+
+	if (level >= SimdLevel::SSE2 && largeFits && (one || smallLast + LOAD_BYTES <= smallW * smallH)) {
+		PatchRows rows;
+		rows.channels = channels;
+		for (int c = 0; c < channels; c++) {
+			rows.small[c] = small[c] + smallFirst;
+			rows.large[c] = large[c] + largeFirst;
+		}
+		rows.smallStride = smallW;
+		rows.largeStride = largeW;
+
+		if (one) {
+			out[0] = diffPatchOneSSE2(rows);
+			return;
+		}
+
+		// the kernels always produce PATCH_ROW_MAX distances
+		// AVX2 gains nothing here: pairing rows in the two lanes costs more than the halved mpsadbw count
+		lcomp all[PATCH_ROW_MAX];
+		if (level >= SimdLevel::SSE41) {
+			diffPatchRowSSE41(rows, all);
+		} else {
+			diffPatchRowSSE2(rows, all);
+		}
+
+		for (int k = 0; k < count; k++) {
+			out[k] = all[k];
+		}
+		return;
+	}
+#endif
+
+	for (int k = 0; k < count; k++) {
+		lcomp ret = 0;
+		for (int c = 0; c < channels; c++) {
+			const uint8_t *s = small[c] + smallFirst + k;
+			const uint8_t *l = large[c] + largeFirst;
+			for (int j = 0; j < PATCH_SIZE; j++) {
+				for (int i = 0; i < PATCH_SIZE; i++) {
+					ret += abs((lcomp)l[i] - (lcomp)s[i]);
+				}
+				s += smallW;
+				l += largeW;
+			}
+		}
+		out[k] = ret;
+	}
+}
+
+void diffPatchRow(const ImageChannels8 &small, int smallPatchX, int smallPatchY,
+	const ImageChannels8 &large, int largePatchX, int largePatchY, int count, lcomp *out) {
+	const uint8_t *smallPlanes[3] = { small.red.data(), small.green.data(), small.blue.data() };
+	const uint8_t *largePlanes[3] = { large.red.data(), large.green.data(), large.blue.data() };
+
+	diffPatchRowPlanes(3, smallPlanes, small.w(), small.h(), smallPatchX, smallPatchY,
+		largePlanes, large.w(), large.h(), largePatchX, largePatchY, count, out);
+}
+
+void diffPatchRowPlane(const uint8_t *small, int smallW, int smallH, int smallPatchX, int smallPatchY,
+	const uint8_t *large, int largeW, int largeH, int largePatchX, int largePatchY, int count, lcomp *out) {
+	diffPatchRowPlanes(1, &small, smallW, smallH, smallPatchX, smallPatchY,
+		&large, largeW, largeH, largePatchX, largePatchY, count, out);
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __PATCH_DISTANCE_H__
+#define __PATCH_DISTANCE_H__
+
+#include <stdlib.h>
+
+#include "../common/ImageChannels.h"
+
+// Side of the square patches the SelfSim scaler matches
+static const int PATCH_SIZE = 5;
+
+// Most candidates diffPatchRow() evaluates in one call
+static const int PATCH_ROW_MAX = 8;
+
+/*!
+\brief Sum of absolute differences of every component between the PATCH_SIZE x PATCH_SIZE
+patches centred at (smallPatchX, smallPatchY) in small and (largePatchX, largePatchY) in large.
+Both patches must lie inside their images.
+*/
+template <typename TS, typename TL>
+lcomp diffPatch(const ImageChannelsT<TS> &small, int smallPatchX, int smallPatchY,
+	const ImageChannelsT<TL> &large, int largePatchX, int largePatchY) {
+
+	int stride0 = small.w();
+	int pixel0X = smallPatchX - PATCH_SIZE / 2;
+	int pixel0Y = smallPatchY - PATCH_SIZE / 2;
+	int pixel0 = pixel0X + stride0 * pixel0Y;
+	const TS *r0 = &small.red[pixel0];
+	const TS *g0 = &small.green[pixel0];
+	const TS *b0 = &small.blue[pixel0];
+
+	int stride1 = large.w();
+	int pixel1X = largePatchX - PATCH_SIZE / 2;
+	int pixel1Y = largePatchY - PATCH_SIZE / 2;
+	int pixel1 = pixel1X + stride1 * pixel1Y;
+	const TL *r1 = &large.red[pixel1];
+	const TL *g1 = &large.green[pixel1];
+	const TL *b1 = &large.blue[pixel1];
+
+	lcomp ret = 0;
+	for (int j = 0; j < PATCH_SIZE; j++) {
+		for (int i = 0; i < PATCH_SIZE; i++) {
+			lcomp dr = (lcomp)*r1 - (lcomp)*r0;
+			lcomp dg = (lcomp)*g1 - (lcomp)*g0;
+			lcomp db = (lcomp)*b1 - (lcomp)*b0;
+			//ret += dr * dr + dg * dg + db * db;
+			ret += abs(dr) + abs(dg) + abs(db);
+
+			r0++; g0++; b0++;
+			r1++; g1++; b1++;
+		}
+
+		r0 += stride0 - PATCH_SIZE;
+		g0 += stride0 - PATCH_SIZE;
+		b0 += stride0 - PATCH_SIZE;
+
+		r1 += stride1 - PATCH_SIZE;
+		g1 += stride1 - PATCH_SIZE;
+		b1 += stride1 - PATCH_SIZE;
+	}
+
+	return ret;
+}
+
+/*!
+\brief diffPatch() of the large patch at (largePatchX, largePatchY) against the count small
+patches centred at (smallPatchX + k, smallPatchY), 0 <= k < count <= PATCH_ROW_MAX, all at once.
+Every patch must lie inside its image. Uses the widest SIMD level allowed by simdLevel();
+count == 1 takes a cheaper kernel, for searches that visit candidates one at a time.
+*/
+void diffPatchRow(const ImageChannels8 &small, int smallPatchX, int smallPatchY,
+	const ImageChannels8 &large, int largePatchX, int largePatchY, int count, lcomp *out);
+
+/*!
+\brief diffPatchRow() on a single plane, such as luma, of smallW x smallH and largeW x largeH bytes.
+*/
+void diffPatchRowPlane(const uint8_t *small, int smallW, int smallH, int smallPatchX, int smallPatchY,
+	const uint8_t *large, int largeW, int largeH, int largePatchX, int largePatchY, int count, lcomp *out);
+
+#endif // ndef __PATCH_DISTANCE_H__
\ No newline at end of file
@@ -1,54 +1,77 @@
-/*
- * Copyright(c) 2018 Michael Georgoulopoulos
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files(the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions :
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
-*/
-
-#include "Scaler.h"
-#include "ScalerFactory.h"
-
-#include "../common/Image.h"
-
-Scaler::Scaler() {
-
-}
-
-Scaler::~Scaler() {
-
-}
-
-Err Scaler::scaleLinear(const Image &src, int dstW, int dstH, Image *dst) {
-	Err e = Err::Success;
-
-	if (dstW == src.w() && dstH == src.h()) {
-		*dst = src;
-		return Err::Success;
-	}
-
-	Scaler *s = ScalerFactory::instance().newScaler(ScalerType::OpenCV_Linear);
-	if (s == nullptr) {
-		return Err::Error;
-	}
-	
-	e = s->scale(src, dstW, dstH, dst);
-
-	delete s;
-
-	return e;
+/*
+ * Copyright(c) 2018 Michael Georgoulopoulos
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Scaler.h"
+#include "ScalerFactory.h"
+
+#include "../common/Image.h"
+#include "../common/ImageView.h"
+
+Scaler::Scaler() {
+
+}
+
+Scaler::~Scaler() {
+
+}
+
+Err Scaler::scale(const ConstImageView &src, int dstW, int dstH, Image *dst) {
+	if (dstW <= 0 || dstH <= 0) {
+		return Err::BadArgument;
+	}
+
+	// every destination pixel gets written
+	dst->setSizeDiscard(dstW, dstH);
+
+	return scale(src, ImageView(*dst));
+}
+
+Err Scaler::scaleLinear(const ConstImageView &src, int dstW, int dstH, Image *dst) {
+	if (dstW <= 0 || dstH <= 0) {
+		return Err::BadArgument;
+	}
+
+	// every destination pixel gets written
+	dst->setSizeDiscard(dstW, dstH);
+
+	return scaleLinear(src, ImageView(*dst));
+}
+
+Err Scaler::scaleLinear(const ConstImageView &src, const ImageView &dst) {
+	Err e = Err::Success;
+
+	if (dst.w() == src.w() && dst.h() == src.h()) {
+		copyPixels(src, dst);
+		return Err::Success;
+	}
+
+	Scaler *s = ScalerFactory::instance().newScaler(ScalerType::OpenCV_Linear);
+	if (s == nullptr) {
+		return Err::Error;
+	}
+	
+	e = s->scale(src, dst);
+
+	delete s;
+
+	return e;
 }
\ No newline at end of file
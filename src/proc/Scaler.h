@@ -1,43 +1,63 @@
-/*
- * Copyright(c) 2018 Michael Georgoulopoulos
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files(the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions :
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
-*/
-
-#ifndef __SCALER_H__
-#define __SCALER_H__
-
-#include "../common/Err.h"
-
-class Image;
-
-class Scaler {
-public:
-	Scaler();
-	virtual ~Scaler();
-
-public:
-	virtual Err scale(const Image &src, int dstW, int dstH, Image *dst) = 0;
-
-public:
-	// Useful for other scalers that depend on a basic linear scaler
-	static Err scaleLinear(const Image &src, int dstW, int dstH, Image *dst);
-};
-
+/*
+ * Copyright(c) 2018 Michael Georgoulopoulos
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#ifndef __SCALER_H__
+#define __SCALER_H__
+
+#include "../common/Err.h"
+
+class Image;
+class ImageView;
+class ConstImageView;
+
+/*!
+\brief Base of all scalers.
+scale() is reentrant: one instance may serve any number of threads at once.
+Implementations keep per-call state on the stack or in a ScratchArena local
+to the call, never in members. Settings such as Scaler2x::setFusedTileSize()
+must not be changed while a scale is running.
+*/
+class Scaler {
+public:
+	Scaler();
+	virtual ~Scaler();
+
+public:
+	/*!
+	\brief Scales src so that it fills dst exactly.
+	Both views may be sub-rectangles of larger images; rows are addressed through their stride.
+	The two views must not overlap.
+	*/
+	virtual Err scale(const ConstImageView &src, const ImageView &dst) = 0;
+
+	/*!
+	\brief Resizes dst to dstW x dstH and scales src into it.
+	*/
+	Err scale(const ConstImageView &src, int dstW, int dstH, Image *dst);
+
+public:
+	// Useful for other scalers that depend on a basic linear scaler
+	static Err scaleLinear(const ConstImageView &src, int dstW, int dstH, Image *dst);
+	static Err scaleLinear(const ConstImageView &src, const ImageView &dst);
+};
+
 #endif // ndef __SCALER_H__
\ No newline at end of file
@@ -1,64 +1,146 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#include <algorithm>
-
-#include "Scaler2x.h"
-
-#include "../common/common.h"
-
-Scaler2x::Scaler2x() {
-
-}
-
-Scaler2x::~Scaler2x() {
-
-}
-
-
-Err Scaler2x::scale(const Image &src, int dstW, int dstH, Image *dst) {
-	Err e = Err::Success;
-
-	if (src.w() <= 0 || src.h() <= 0 || dstW <= 0 || dstH <= 0) {
-		return Err::BadArgument;
-	}
-
-	// Couldn't hurt
-	if (dstW == src.w() && dstH == src.h()) {
-		*dst = src;
-		return Err::Success;
-	}
-
-	Image tmp = src;
-
-	// Double in size until we reach or exceed destination size
-	while (tmp.w() < dstW || tmp.h() < dstH) {
-		Image tmp2;
-		scale2x(tmp, &tmp2);
-		tmp = tmp2;
-	}
-
-	// Finally, use a linear scaler to reach exactly destination size
-	e = scaleLinear(tmp, dstW, dstH, dst); ree;
-
-	return e;
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "Scaler2x.h"
+
+#include "../common/common.h"
+
+Scaler2x::Scaler2x() : mFusedTileSize(0) {
+
+}
+
+Scaler2x::~Scaler2x() {
+
+}
+
+
+Err Scaler2x::scale(const ConstImageView &src, const ImageView &dst) {
+	Err e = Err::Success;
+
+	int dstW = dst.w();
+	int dstH = dst.h();
+
+	if (src.w() <= 0 || src.h() <= 0 || dstW <= 0 || dstH <= 0) {
+		return Err::BadArgument;
+	}
+
+	// Couldn't hurt
+	if (dstW == src.w() && dstH == src.h()) {
+		copyPixels(src, dst);
+		return Err::Success;
+	}
+
+	// Work out the final doubled size up front, so that the level buffers are allocated once
+	int levels = 0;
+	int finalW = src.w();
+	int finalH = src.h();
+	while (finalW < dstW || finalH < dstH) {
+		finalW *= 2;
+		finalH *= 2;
+		levels++;
+	}
+
+	if (levels > 1 && mFusedTileSize > 0 && fusable(src)) {
+		return scaleFused(src, levels, dst);
+	}
+
+	// Levels ping-pong between two buffers; the last one lands in buffers[(levels - 1) % 2]
+	Image buffers[2];
+	if (levels > 0) {
+		buffers[(levels - 1) % 2].reserve(finalW * finalH);
+	}
+	if (levels > 1) {
+		buffers[levels % 2].reserve((finalW / 2) * (finalH / 2));
+	}
+
+	// The first level reads straight from the source view
+	ConstImageView level = src;
+
+	// Double in size until we reach or exceed destination size
+	for (int i = 0; i < levels; i++) {
+		Image &out = buffers[i % 2];
+		e = scale2x(level, &out); ree;
+		level = out;
+	}
+
+	// Finally, use a linear scaler to reach exactly destination size
+	e = scaleLinear(level, dst); ree;
+
+	return e;
+}
+
+Err Scaler2x::scaleFused(const ConstImageView &src, int levels, const ImageView &dst) {
+	Err e = Err::Success;
+
+	int factor = 1 << levels;
+	int finalW = src.w() * factor;
+	int finalH = src.h() * factor;
+
+	// Tiles go straight to dst when no final resize is needed
+	bool exact = finalW == dst.w() && finalH == dst.h();
+	Image finalLevel;
+	if (!exact) {
+		finalLevel.setSizeDiscard(finalW, finalH);
+	}
+	ImageView target = exact ? dst : ImageView(finalLevel);
+
+	// Even tile origins and halos keep any 2:1 resampling a scaler does
+	// internally on the same grid as for the full image
+	int tileSize = (mFusedTileSize + 1) & ~1;
+	int halo = (fusedHalo() + 1) & ~1;
+
+	Image buffers[2];
+
+	for (int y0 = 0; y0 < src.h(); y0 += tileSize) {
+		for (int x0 = 0; x0 < src.w(); x0 += tileSize) {
+			int tw = std::min(tileSize, src.w() - x0);
+			int th = std::min(tileSize, src.h() - y0);
+
+			// the tile with its halo, cut off at the image edges where
+			// the scalers clamp exactly like they do for the full image
+			int cx0 = std::max(0, x0 - halo);
+			int cy0 = std::max(0, y0 - halo);
+			int cx1 = std::min(src.w(), x0 + tw + halo);
+			int cy1 = std::min(src.h(), y0 + th + halo);
+
+			ConstImageView level = src.sub(cx0, cy0, cx1 - cx0, cy1 - cy0);
+
+			for (int i = 0; i < levels; i++) {
+				Image &out = buffers[i % 2];
+				e = scale2x(level, &out); ree;
+				level = out;
+			}
+
+			// keep only the tile itself; the scaled halo is not accurate near its outer edge
+			ConstImageView tile = level.sub((x0 - cx0) * factor, (y0 - cy0) * factor, tw * factor, th * factor);
+			copyPixels(tile, target.sub(x0 * factor, y0 * factor, tw * factor, th * factor));
+		}
+	}
+
+	if (!exact) {
+		e = scaleLinear(finalLevel, dst); ree;
+	}
+
+	return e;
 }
\ No newline at end of file
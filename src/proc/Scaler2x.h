@@ -1,43 +1,71 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#ifndef __SCALER_2X_H__
-#define __SCALER_2X_H__
-
-#include "Scaler.h"
-
-// TODO: Remove
-#include "../common/Image.h"
-
-class Scaler2x : public Scaler {
-public:
-	Scaler2x();
-	virtual ~Scaler2x();
-
-public:
-	Err scale(const Image &src, int dstW, int dstH, Image *dst) override;
-
-private:
-	virtual Err scale2x(const Image &src, Image *dst) = 0;
-};
-
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __SCALER_2X_H__
+#define __SCALER_2X_H__
+
+#include "Scaler.h"
+
+// TODO: Remove
+#include "../common/Image.h"
+#include "../common/ImageView.h"
+
+class Scaler2x : public Scaler {
+public:
+	Scaler2x();
+	virtual ~Scaler2x();
+
+public:
+	using Scaler::scale;
+	Err scale(const ConstImageView &src, const ImageView &dst) override;
+
+	/*!
+	\brief Tile size, in source pixels, of the fused cascade; 0 turns it off.
+	For factors above 2x, the fused cascade takes one source tile (plus a halo)
+	at a time through all doubling levels while it is still in cache, and only
+	writes out the last level, instead of materialising every intermediate level.
+	*/
+	void setFusedTileSize(int tileSize) { mFusedTileSize = std::max(0, tileSize); }
+	int fusedTileSize() const { return mFusedTileSize; }
+
+protected:
+	/*!
+	\brief Source pixels of context a tile needs on every side for the fused
+	cascade to reproduce the level-by-level result.
+	*/
+	virtual int fusedHalo() const = 0;
+
+	/*!
+	\brief Whether the fused cascade reproduces the level-by-level result for src.
+	When it does not, scale() materialises every level even if the cascade is on.
+	*/
+	virtual bool fusable(const ConstImageView &src) const { return true; }
+
+private:
+	virtual Err scale2x(const ConstImageView &src, Image *dst) = 0;
+
+	Err scaleFused(const ConstImageView &src, int levels, const ImageView &dst);
+
+	int mFusedTileSize;
+};
+
 #endif // ndef __SCALER_2X_H__
\ No newline at end of file
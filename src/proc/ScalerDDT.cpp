@@ -1,268 +1,665 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#include <algorithm>
-
-#include "ScalerDDT.h"
-
-#include "../common/common.h"
-
-ScalerDDT::ScalerDDT() {
-
-}
-
-ScalerDDT::~ScalerDDT() {
-
-}
-
-Err ScalerDDT::scale(const Image &src, int dstW, int dstH, Image *dst) {
-	Err e = Err::Success;
-
-	// Couldn't hurt
-	if (dstW == src.w() && dstH == src.h()) {
-		*dst = src;
-		return Err::Success;
-	}
-
-	if (src.w() <= 1 || src.h() <= 1) {
-		return Err::BadArgument;
-	}
-
-	e = createEdges(src); ree;
-
-	dst->setSize(dstW, dstH);
-
-	for (int j = 0; j < dstH; j++) {
-		for (int i = 0; i < dstW; i++) {
-			dst->setPixel(i, j, bilinear(src, i, dstW, j, dstH));
-		}
-	}
-
-	return e;
-}
-
-Err ScalerDDT::createEdges(const Image &src) {
-	Err e = Err::Success;
-
-	if (src.w() <= 1 || src.h() <= 1) {
-		return Err::BadArgument;
-	}
-
-	int edgesW = src.w() - 1;
-	int edgesH = src.h() - 1;
-	edges.resize(edgesW * edgesH);
-
-	for (int j = 0; j < edgesH; j++) {
-		for (int i = 0; i < edgesW; i++) {
-			// Get 4 neighbouring colors
-			color nw = src.getPixel(i, j);
-			color ne = src.getPixel(i + 1, j);
-			color se = src.getPixel(i + 1, j + 1);
-			color sw = src.getPixel(i, j + 1);
-
-			// calculate brighness
-			comp lnw = L(nw);
-			comp lne = L(ne);
-			comp lse = L(se);
-			comp lsw = L(sw);
-
-			// decide edge direction
-			bool slash = true;
-			if (abs(lnw - lse) < abs(lne - lsw)) {
-				slash = false;
-			}
-
-			// store edge
-			edges[i + edgesW * j] = slash;
-		}
-	}
-
-	// extended method: post-process
-	auto tmp = edges;
-
-	for (int j = 0; j < edgesH; j++) {
-		if (j < 1 || j >= edgesH - 2) {
-			continue;
-		}
-		for (int i = 0; i < edgesW; i++) {
-			if (i < 1 || i >= edgesW - 2) {
-				continue;
-			}
-			
-			// count slashes
-			int slashCount = 0;
-			for (int nj = -1; nj <= 1; nj++) {
-				for (int ni = -1; ni <= 1; ni++) {
-					if (ni == 0 && nj == 0) {
-						continue;
-					}
-
-					if (tmp[(i + ni) + (j + nj) * edgesW]) {
-						slashCount++;
-					}
-				}
-			}
-
-			int idx = i + j * edgesW;
-
-			if (slashCount == 4) {
-				// draw - keep original
-				edges[idx] = tmp[idx];
-			} else if (slashCount > 4) {
-				edges[idx] = true; // slash
-			} else {
-				edges[idx] = false; // backslash
-			}
-		}
-	}
-
-	return e;
-}
-
-pixel ScalerDDT::bilinear(const Image &src, int i, int dstW, int j, int dstH) {	
-
-	// We want to map the center of the first pixel (u=0.5) to the center of the first source pixel (u=0.5 also)
-	// We want to map the center of the last pixel (u=width-0.5) to the center of the source last pixel (u=sourceWidth-0.5)
-	// So, in reality, scale is (source - 1) / (destination -  1);
-	float scaleX = (float)(src.w()-1) / (float)(dstW-1);
-	float scaleY = (float)(src.h()-1) / (float)(dstH-1);
-
-	// map coordinates to original image
-	float sif = (float) i * scaleX + 0.5f;
-	float sjf = (float)j * scaleY + 0.5f;
-
-	// find neighbouring pixels
-	int si = (int)sif;
-	int sj = (int)sjf;
-
-	// get sub-pixel coordinates
-	float u = sif - si;
-	float v = sjf - sj;
-
-	// get coordinates to the edge table
-	int ei = si;
-	if (u < 0.5f) {
-		si--;
-		ei--;
-		u += 0.5f;
-	} else {
-		u -= 0.5f;
-	}
-
-	int ej = sj;
-	if (v < 0.5f) {
-		sj--;
-		ej--;
-		v += 0.5f;
-	} else {
-		v -= 0.5f;
-	}
-
-	// clamp to edge table dimensions
-	ei = std::max(0, std::min(src.w() - 2, ei));
-	ej = std::max(0, std::min(src.h() - 2, ej));
-
-	// see which edge was selected for triangulation
-	bool slash = edges[ei + ej * (src.w() - 1)];
-
-	if (slash) {
-		return sampleSlash(src, si, sj, u, v);
-	} else {
-		return sampleBackslash(src, si, sj, u, v);
-	}
-}
-
-pixel ScalerDDT::sampleSlash(const Image &src, int i, int j, float u, float v) {
-	if (u + v <= 1.0f) {
-		// upper triangle
-		pixel a = src.getPixel(i, j);
-		pixel b = src.getPixel(i + 1, j);
-		pixel c = src.getPixel(i, j + 1);
-		return mix3(a, b, c, u, v);
-	} else {
-		// bottom triangle
-		pixel a = src.getPixel(i + 1, j + 1);
-		pixel b = src.getPixel(i, j + 1);
-		pixel c = src.getPixel(i + 1, j);
-		return mix3(a, b, c, 1.0f - u, 1.0f - v);
-	}
-}
-	
-pixel ScalerDDT::sampleBackslash(const Image &src, int i, int j, float u, float v) {
-	if (u >= v) {
-		// upper triangle
-		pixel a = src.getPixel(i + 1, j);
-		pixel b = src.getPixel(i, j);
-		pixel c = src.getPixel(i + 1, j + 1);
-		return mix3(a, b, c, 1.0f - u, v);
-	} else {
-		// bottom triangle
-		pixel a = src.getPixel(i, j + 1);
-		pixel b = src.getPixel(i + 1, j + 1);
-		pixel c = src.getPixel(i, j);
-		return mix3(a, b, c, u, 1.0f - v);
-	}
-}
-
-pixel ScalerDDT::mix3(pixel a, pixel b, pixel c, float u, float v) {
-	// unpack a
-	float ar = R(a);
-	float ag = G(a);
-	float ab = B(a);
-
-	// unpack b
-	float br = R(b);
-	float bg = G(b);
-	float bb = B(b);
-
-	// unpack c
-	float cr = R(c);
-	float cg = G(c);
-	float cb = B(c);
-
-	// cache
-	float omu = 1.0f - u;
-	float omv = 1.0f - v;
-
-	// mix horizontally
-	float r1 = ar * omu + br * u;
-	float r2 = cr * omu + br * u;
-	float g1 = ag * omu + bg * u;
-	float g2 = cg * omu + bg * u;
-	float b1 = ab * omu + bb * u;
-	float b2 = cb * omu + bb * u;
-
-	// mix vertically
-	float fr = r1 * omv + r2 * v;
-	float fg = g1 * omv + g2 * v;
-	float fb = b1 * omv + b2 * v;
-
-	// Convert to integer
-	comp finalR = (comp)std::max(0.0f, std::min(255.0f, fr));
-	comp finalG = (comp)std::max(0.0f, std::min(255.0f, fg));
-	comp finalB = (comp)std::max(0.0f, std::min(255.0f, fb));
-
-	// re-pack
-	pixel ret = RGB(finalR, finalG, finalB);
-
-	return ret;
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+#include <limits.h>
+#include <memory>
+#include <string.h>
+#include <vector>
+
+#include "ScalerDDT.h"
+
+#include "../common/common.h"
+#include "../common/Cpu.h"
+#include "../common/ScratchArena.h"
+#include "../common/ThreadPool.h"
+
+#ifdef UPSCALE_X86
+#include <immintrin.h>
+#endif
+
+// Added before the final shift of the SIMD sampler. Every fixed-point product
+// rounds down, so this keeps exact values (flat areas) from dropping a level.
+#define FIXED_BIAS 4
+
+#ifdef UPSCALE_X86
+
+// Spreads the weights of pixels 2k and 2k + 1 over the four channels of each
+TARGET_SSE2 static inline void spreadWeights(__m128i w, __m128i out[4]) {
+	__m128i lo = _mm_unpacklo_epi16(w, w);
+	__m128i hi = _mm_unpackhi_epi16(w, w);
+	out[0] = _mm_unpacklo_epi32(lo, lo);
+	out[1] = _mm_unpackhi_epi32(lo, lo);
+	out[2] = _mm_unpacklo_epi32(hi, hi);
+	out[3] = _mm_unpackhi_epi32(hi, hi);
+}
+
+// Two pixels, each channel in the high byte of a 16-bit lane
+TARGET_SSE2 static inline __m128i loadPixelPair(const pixel *p) {
+	return _mm_unpacklo_epi8(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i *)p));
+}
+
+TARGET_SSE2 static inline __m128i select(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/*
+Same as sampleSlash() / sampleBackslash() over a run of a destination row, 8
+pixels at a time. Each pixel is a weighted sum of its quad's 4 corners with
+15-bit fixed-point weights; the weight of the corner outside the selected
+triangle is zero, so the triangle is picked with masks instead of branches.
+The interpolation jumps across the diagonal, so which side a pixel is on is
+still decided on the float coordinates. Returns the number of pixels written;
+output may be 1 level off the float path.
+*/
+TARGET_SSE2 static int sampleRowSSE2(const pixel *top, const pixel *bottom, const uint64_t *edgeRow,
+	const ScalerDDT::AxisSample *columns, const ScalerDDT::AxisSample &row, int n, pixel *out) {
+	const __m128i one = _mm_set1_epi16((short)ScalerDDT::FIXED_ONE);
+	const __m128i bias = _mm_set1_epi16(FIXED_BIAS);
+	const __m128i V = _mm_set1_epi16((short)row.q);
+	const __m128i V2 = _mm_slli_epi16(V, 1);
+	const __m128i IV = _mm_sub_epi16(one, V);
+
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		// gather the corners of every pixel's quad
+		alignas(16) uint16_t u[8];
+		alignas(16) uint16_t slash[8];
+		alignas(16) uint16_t upper[8];
+		alignas(16) pixel nw[8], ne[8], sw[8], se[8];
+		for (int k = 0; k < 8; k++) {
+			const ScalerDDT::AxisSample &col = columns[i + k];
+			u[k] = (uint16_t)col.q;
+			bool isSlash = (edgeRow[col.e >> 6] >> (col.e & 63)) & 1;
+			bool isUpper = isSlash ? col.f + row.f <= 1.0f : col.f >= row.f;
+			slash[k] = isSlash ? 0xFFFF : 0;
+			upper[k] = isUpper ? 0xFFFF : 0;
+			nw[k] = top[col.s];
+			ne[k] = top[col.s + 1];
+			sw[k] = bottom[col.s];
+			se[k] = bottom[col.s + 1];
+		}
+
+		__m128i U = _mm_load_si128((const __m128i *)u);
+		__m128i IU = _mm_sub_epi16(one, U);
+
+		// products in [0, 1), as (a * b) >> 15
+		__m128i uv = _mm_mulhi_epu16(_mm_slli_epi16(U, 1), V);
+		__m128i uIv = _mm_mulhi_epu16(_mm_slli_epi16(U, 1), IV);
+		__m128i iuV = _mm_mulhi_epu16(V2, IU);
+		__m128i iuIv = _mm_sub_epi16(_mm_sub_epi16(one, U), iuV);
+
+		__m128i isSlash = _mm_load_si128((const __m128i *)slash);
+		__m128i isUpper = _mm_load_si128((const __m128i *)upper);
+
+		// slash upper and backslash lower use nw, sw; slash lower and backslash upper use ne, se
+		__m128i west = _mm_xor_si128(_mm_xor_si128(isSlash, isUpper), _mm_set1_epi16(-1));
+
+		__m128i weights[4][4];
+		spreadWeights(select(west, iuIv, _mm_andnot_si128(isSlash, IU)), weights[0]);
+		spreadWeights(select(west, _mm_and_si128(isSlash, U), uIv), weights[1]);
+		spreadWeights(select(west, iuV, _mm_and_si128(isSlash, IU)), weights[2]);
+		spreadWeights(select(west, _mm_andnot_si128(isSlash, U), uv), weights[3]);
+
+		__m128i mixed[4];
+		for (int k = 0; k < 4; k++) {
+			// Q7 result: (p << 8) * w >> 16 == p * w / 256
+			__m128i sum = bias;
+			sum = _mm_add_epi16(sum, _mm_mulhi_epu16(loadPixelPair(nw + 2 * k), weights[0][k]));
+			sum = _mm_add_epi16(sum, _mm_mulhi_epu16(loadPixelPair(ne + 2 * k), weights[1][k]));
+			sum = _mm_add_epi16(sum, _mm_mulhi_epu16(loadPixelPair(sw + 2 * k), weights[2][k]));
+			sum = _mm_add_epi16(sum, _mm_mulhi_epu16(loadPixelPair(se + 2 * k), weights[3][k]));
+			mixed[k] = _mm_srli_epi16(sum, 7);
+		}
+
+		_mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi16(mixed[0], mixed[1]));
+		_mm_storeu_si128((__m128i *)(out + i + 4), _mm_packus_epi16(mixed[2], mixed[3]));
+	}
+	return i;
+}
+
+#endif // def UPSCALE_X86
+
+void ScalerDDT::mapAxis(int srcSize, int dstSize, AxisSample *out) {
+	// We want to map the center of the first pixel (u=0.5) to the center of the first source pixel (u=0.5 also)
+	// We want to map the center of the last pixel (u=width-0.5) to the center of the source last pixel (u=sourceWidth-0.5)
+	// So, in reality, scale is (source - 1) / (destination -  1);
+	float scale = (float)(srcSize - 1) / (float)(dstSize - 1);
+
+	for (int d = 0; d < dstSize; d++) {
+		// map coordinate to original image
+		float sf = (float)d * scale + 0.5f;
+
+		// find neighbouring pixel and sub-pixel coordinate
+		int s = (int)sf;
+		float f = sf - s;
+
+		// get coordinate to the edge table
+		int e = s;
+		if (f < 0.5f) {
+			s--;
+			e--;
+			f += 0.5f;
+		} else {
+			f -= 0.5f;
+		}
+
+		// clamp to edge table dimensions
+		out[d].s = s;
+		out[d].e = std::max(0, std::min(srcSize - 2, e));
+		out[d].f = f;
+		out[d].q = std::min(FIXED_ONE - 1, (int)(f * FIXED_ONE + 0.5f));
+	}
+}
+
+// (R + G + B) truncated to 8 bits, like the comp brightness the edge test always used
+static void lumaRowScalar(const pixel *row, int n, uint8_t *out) {
+	for (int i = 0; i < n; i++) {
+		out[i] = (uint8_t)L(row[i]);
+	}
+}
+
+// Sets bit i of out (which must start zeroed) when quad i should be split along '/',
+// that is unless |nw - se| < |ne - sw| in luma
+static void edgeRowScalar(const uint8_t *top, const uint8_t *bottom, int i0, int n, uint64_t *out) {
+	for (int i = i0; i < n; i++) {
+		int dSlash = abs(top[i] - bottom[i + 1]);
+		int dBackslash = abs(top[i + 1] - bottom[i]);
+		if (!(dSlash < dBackslash)) {
+			out[i >> 6] |= (uint64_t)1 << (i & 63);
+		}
+	}
+}
+
+#ifdef UPSCALE_X86
+
+TARGET_SSE2 static int lumaRowSSE2(const pixel *row, int n, uint8_t *out) {
+	const __m128i ff = _mm_set1_epi32(0xFF);
+
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i l[4];
+		for (int k = 0; k < 4; k++) {
+			__m128i p = _mm_loadu_si128((const __m128i *)(row + i + 4 * k));
+			__m128i sum = _mm_add_epi32(_mm_srli_epi32(p, 24),
+				_mm_add_epi32(_mm_and_si128(_mm_srli_epi32(p, 16), ff), _mm_and_si128(_mm_srli_epi32(p, 8), ff)));
+			l[k] = _mm_and_si128(sum, ff);
+		}
+		__m128i bytes = _mm_packus_epi16(_mm_packs_epi32(l[0], l[1]), _mm_packs_epi32(l[2], l[3]));
+		_mm_storeu_si128((__m128i *)(out + i), bytes);
+	}
+	return i;
+}
+
+TARGET_SSE2 static int edgeRowSSE2(const uint8_t *top, const uint8_t *bottom, int n, uint64_t *out) {
+	const __m128i zero = _mm_setzero_si128();
+
+	// 16 cells at a time, so a group never straddles two words
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i nw = _mm_loadu_si128((const __m128i *)(top + i));
+		__m128i ne = _mm_loadu_si128((const __m128i *)(top + i + 1));
+		__m128i sw = _mm_loadu_si128((const __m128i *)(bottom + i));
+		__m128i se = _mm_loadu_si128((const __m128i *)(bottom + i + 1));
+
+		__m128i dSlash = _mm_or_si128(_mm_subs_epu8(nw, se), _mm_subs_epu8(se, nw));
+		__m128i dBackslash = _mm_or_si128(_mm_subs_epu8(ne, sw), _mm_subs_epu8(sw, ne));
+
+		// dSlash >= dBackslash exactly where the saturating difference is zero
+		__m128i slash = _mm_cmpeq_epi8(_mm_subs_epu8(dBackslash, dSlash), zero);
+
+		uint64_t bits = (uint64_t)(uint16_t)_mm_movemask_epi8(slash);
+		out[i >> 6] |= bits << (i & 63);
+	}
+	return i;
+}
+
+#endif // def UPSCALE_X86
+
+static void lumaRow(const pixel *row, int n, uint8_t *out) {
+	int i = 0;
+
+#ifdef UPSCALE_X86
+	if (simdLevel() >= SimdLevel::SSE2) {
+		i = lumaRowSSE2(row, n, out);
+	}
+#endif
+
+	lumaRowScalar(row + i, n - i, out + i);
+}
+
+static void edgeRow(const uint8_t *top, const uint8_t *bottom, int n, uint64_t *out) {
+	int i = 0;
+
+#ifdef UPSCALE_X86
+	if (simdLevel() >= SimdLevel::SSE2) {
+		i = edgeRowSSE2(top, bottom, n, out);
+	}
+#endif
+
+	edgeRowScalar(top, bottom, i, n, out);
+}
+
+// Bit-sliced adders: every bit position is a separate 1-bit lane
+static inline void halfAdd(uint64_t a, uint64_t b, uint64_t *sum, uint64_t *carry) {
+	*sum = a ^ b;
+	*carry = a & b;
+}
+
+static inline void fullAdd(uint64_t a, uint64_t b, uint64_t c, uint64_t *sum, uint64_t *carry) {
+	uint64_t t = a ^ b;
+	*sum = t ^ c;
+	*carry = (a & b) | (t & c);
+}
+
+// 3x3 majority vote of 64 cells at once. The 8 neighbours are counted into a
+// 4-bit number per cell; more than 4 slashes gives a slash, fewer a
+// backslash, and a draw keeps the cell as it was.
+static inline uint64_t majority(uint64_t nw, uint64_t n, uint64_t ne, uint64_t w, uint64_t c, uint64_t e,
+	uint64_t sw, uint64_t s, uint64_t se) {
+	uint64_t s1, c1, s2, c2, s3, c3;
+	fullAdd(nw, n, ne, &s1, &c1);
+	fullAdd(w, e, sw, &s2, &c2);
+	halfAdd(s, se, &s3, &c3);
+
+	// weight 1
+	uint64_t bit0, carry0;
+	fullAdd(s1, s2, s3, &bit0, &carry0);
+
+	// weight 2: c1, c2, c3 and carry0
+	uint64_t t, carry1, bit1, carry2;
+	fullAdd(c1, c2, c3, &t, &carry1);
+	halfAdd(t, carry0, &bit1, &carry2);
+
+	// weight 4 and 8
+	uint64_t bit2 = carry1 ^ carry2;
+	uint64_t bit3 = carry1 & carry2;
+
+	uint64_t moreThan4 = bit3 | (bit2 & (bit1 | bit0));
+	uint64_t exactly4 = bit2 & ~bit1 & ~bit0 & ~bit3;
+
+	return moreThan4 | (exactly4 & c);
+}
+
+/*
+The edge map, produced a row at a time as the output is written top to bottom.
+Voting on row j needs the raw rows j - 1 to j + 1, and raw row j needs the luma
+of source rows j and j + 1, so only those are kept around. Rows that are
+skipped over are never computed, so a band of rows can start anywhere.
+*/
+class EdgeRows {
+public:
+	EdgeRows(const ConstImageView &src, ScratchArena &scratch) : src(src) {
+		edgesW = src.w() - 1;
+		edgesH = src.h() - 1;
+		words = (edgesW + 63) / 64;
+
+		for (int k = 0; k < 3; k++) {
+			raw[k] = scratch.alloc<uint64_t>(words);
+		}
+		voted = scratch.alloc<uint64_t>(words);
+		votedRow = -1;
+
+		luma[0] = scratch.alloc<uint8_t>(src.w());
+		luma[1] = scratch.alloc<uint8_t>(src.w());
+		lumaRow(src.row(0), src.w(), luma[0]);
+		rawCount = 0;
+
+		// The first and the last two columns keep their raw value
+		inner = scratch.alloc<uint64_t>(words, true);
+		for (int i = 1; i < edgesW - 2; i++) {
+			inner[i >> 6] |= (uint64_t)1 << (i & 63);
+		}
+	}
+
+	/*!
+	\brief Final row j of the map. j must not decrease from one call to the next.
+	*/
+	const uint64_t *row(int j) {
+		int first = std::max(0, j - 1);
+		if (rawCount < first) {
+			rawCount = first;
+			lumaRow(src.row(first), src.w(), luma[first % 2]);
+		}
+
+		int needed = std::min(j + 1, edgesH - 1);
+		while (rawCount <= needed) {
+			computeRaw();
+		}
+
+		// extended method: post-process with a majority vote of the 8 neighbours.
+		// The first and the last two rows keep their raw value.
+		if (j < 1 || j >= edgesH - 2) {
+			return raw[j % 3];
+		}
+
+		if (votedRow != j) {
+			vote(raw[(j - 1) % 3], raw[j % 3], raw[(j + 1) % 3]);
+			votedRow = j;
+		}
+		return voted;
+	}
+
+private:
+	// Decides the diagonal of every quad in the next raw row from the luma of its corners.
+	// Every luma row is computed once and used for the quads above and below it.
+	void computeRaw() {
+		int j = rawCount++;
+
+		const uint8_t *top = luma[j % 2];
+		uint8_t *bottom = luma[(j + 1) % 2];
+		lumaRow(src.row(j + 1), src.w(), bottom);
+
+		uint64_t *out = raw[j % 3];
+		memset(out, 0, words * sizeof(uint64_t));
+		edgeRow(top, bottom, edgesW, out);
+	}
+
+	void vote(const uint64_t *rowN, const uint64_t *rowC, const uint64_t *rowS) {
+		for (int k = 0; k < words; k++) {
+			// bit i of the word holds cell 64 * k + i; west neighbours are one bit
+			// lower, so shift them up, pulling in the top bit of the previous word
+			uint64_t prevN = k > 0 ? rowN[k - 1] : 0;
+			uint64_t prevC = k > 0 ? rowC[k - 1] : 0;
+			uint64_t prevS = k > 0 ? rowS[k - 1] : 0;
+			uint64_t nextN = k + 1 < words ? rowN[k + 1] : 0;
+			uint64_t nextC = k + 1 < words ? rowC[k + 1] : 0;
+			uint64_t nextS = k + 1 < words ? rowS[k + 1] : 0;
+
+			uint64_t m = majority(
+				(rowN[k] << 1) | (prevN >> 63), rowN[k], (rowN[k] >> 1) | (nextN << 63),
+				(rowC[k] << 1) | (prevC >> 63), rowC[k], (rowC[k] >> 1) | (nextC << 63),
+				(rowS[k] << 1) | (prevS >> 63), rowS[k], (rowS[k] >> 1) | (nextS << 63));
+
+			voted[k] = (m & inner[k]) | (rowC[k] & ~inner[k]);
+		}
+	}
+
+private:
+	const ConstImageView &src;
+	int edgesW, edgesH;
+	// row length in 64-bit words; bit i of word k is quad 64 * k + i
+	int words;
+
+	// raw row j is in raw[j % 3]; rows up to rawCount - 1 are done
+	uint64_t *raw[3];
+	int rawCount;
+	uint64_t *voted;
+	int votedRow;
+
+	uint8_t *luma[2];
+	uint64_t *inner;
+};
+
+// Source row y (clamped) with one replicated pixel on either side; out[-1] must be writable
+static void padRow(const ConstImageView &src, int y, pixel *out) {
+	const pixel *row = src.row(std::max(0, std::min(src.h() - 1, y)));
+	memcpy(out, row, src.w() * sizeof(pixel));
+	out[-1] = row[0];
+	out[src.w()] = row[src.w() - 1];
+}
+
+/*
+Everything one thread needs to produce output rows: its own edge rows and the
+two source rows in use. Rows must be asked for in increasing order, but bands
+may be far apart.
+*/
+class ScalerDDT::RowSampler {
+public:
+	RowSampler(const ConstImageView &src, const AxisSample *columns, const AxisSample *rows, int dstW)
+		: src(src), edges(src, scratch), columns(columns), rows(rows), dstW(dstW) {
+		// Sampling reaches at most one pixel outside the source; the two source
+		// rows in use are kept with a replicated pixel on either side.
+		top = scratch.alloc<pixel>(src.w() + 2) + 1;
+		bottom = scratch.alloc<pixel>(src.w() + 2) + 1;
+		paddedRow = INT_MIN;
+	}
+
+	/*!
+	\brief Writes output rows j0 to j1 - 1 to out, row j0 first.
+	*/
+	void sample(int j0, int j1, const ImageView &out) {
+		for (int j = j0; j < j1; j++) {
+			const AxisSample &row = rows[j];
+			const uint64_t *edgeRow = edges.row(row.e);
+
+			if (row.s != paddedRow) {
+				if (row.s == paddedRow + 1) {
+					std::swap(top, bottom);
+				} else {
+					padRow(src, row.s, top);
+				}
+				padRow(src, row.s + 1, bottom);
+				paddedRow = row.s;
+			}
+
+			pixel *dstRow = out.row(j - j0);
+			int i = 0;
+
+#ifdef UPSCALE_X86
+			if (simdLevel() >= SimdLevel::SSE2) {
+				i = sampleRowSSE2(top, bottom, edgeRow, columns, row, dstW, dstRow);
+			}
+#endif
+
+			for (; i < dstW; i++) {
+				const AxisSample &col = columns[i];
+
+				// see which edge was selected for triangulation
+				if ((edgeRow[col.e >> 6] >> (col.e & 63)) & 1) {
+					dstRow[i] = sampleSlash(top, bottom, col.s, col.f, row.f);
+				} else {
+					dstRow[i] = sampleBackslash(top, bottom, col.s, col.f, row.f);
+				}
+			}
+		}
+	}
+
+private:
+	const ConstImageView &src;
+	// declared before edges, which allocates from it
+	ScratchArena scratch;
+	EdgeRows edges;
+
+	const AxisSample *columns;
+	const AxisSample *rows;
+	int dstW;
+
+	pixel *top;
+	pixel *bottom;
+	int paddedRow;
+};
+
+ScalerDDT::ScalerDDT() : mThreadCount(1) {
+
+}
+
+ScalerDDT::~ScalerDDT() {
+
+}
+
+Err ScalerDDT::scale(const ConstImageView &src, const ImageView &dst) {
+	int dstW = dst.w();
+	int dstH = dst.h();
+
+	// Couldn't hurt
+	if (dstW == src.w() && dstH == src.h()) {
+		copyPixels(src, dst);
+		return Err::Success;
+	}
+
+	if (src.w() <= 1 || src.h() <= 1) {
+		return Err::BadArgument;
+	}
+
+	// Everything the call needs is local to it, so one instance can serve several threads.
+	// The arena's buffers come from the shared pool, so this does not allocate in steady state.
+	ScratchArena scratch;
+
+	// Coordinates depend only on the column or only on the row; map them once
+	AxisSample *columns = scratch.alloc<AxisSample>(dstW);
+	AxisSample *rows = scratch.alloc<AxisSample>(dstH);
+	mapAxis(src.w(), dstW, columns);
+	mapAxis(src.h(), dstH, rows);
+
+	// One block of rows per thread. Each builds the edge rows it needs,
+	// including the row above and below its block that the vote reads.
+	int blocks = std::min(dstH, threads());
+	ThreadPool::instance().parallelFor(blocks, blocks, [&](int k) {
+		int j0 = (int)((int64_t)dstH * k / blocks);
+		int j1 = (int)((int64_t)dstH * (k + 1) / blocks);
+
+		RowSampler sampler(src, columns, rows, dstW);
+		sampler.sample(j0, j1, dst.sub(0, j0, dstW, j1 - j0));
+	});
+
+	return Err::Success;
+}
+
+Err ScalerDDT::scaleRows(const ConstImageView &src, int dstW, int dstH, RowSink &sink) {
+	Err e = Err::Success;
+
+	if (dstW == src.w() && dstH == src.h()) {
+		for (int j = 0; j < dstH; j++) {
+			e = sink.consume(j, src.row(j)); ree;
+		}
+		return e;
+	}
+
+	if (src.w() <= 1 || src.h() <= 1) {
+		return Err::BadArgument;
+	}
+
+	ScratchArena scratch;
+
+	AxisSample *columns = scratch.alloc<AxisSample>(dstW);
+	AxisSample *rows = scratch.alloc<AxisSample>(dstH);
+	mapAxis(src.w(), dstW, columns);
+	mapAxis(src.h(), dstH, rows);
+
+	// Rows are produced a band at a time, each thread doing its share of the band
+	// with a sampler of its own, and handed out in order once the band is done.
+	int threadCount = threads();
+	int bandRows = threadCount * BAND_ROWS;
+	ImageView band(scratch.alloc<pixel>((size_t)bandRows * dstW), dstW, bandRows, dstW);
+
+	std::vector<std::unique_ptr<RowSampler>> samplers;
+	for (int k = 0; k < threadCount; k++) {
+		samplers.emplace_back(new RowSampler(src, columns, rows, dstW));
+	}
+
+	for (int b0 = 0; b0 < dstH; b0 += bandRows) {
+		int b1 = std::min(dstH, b0 + bandRows);
+
+		ThreadPool::instance().parallelFor(threadCount, threadCount, [&](int k) {
+			int j0 = b0 + (b1 - b0) * k / threadCount;
+			int j1 = b0 + (b1 - b0) * (k + 1) / threadCount;
+			samplers[k]->sample(j0, j1, band.sub(0, j0 - b0, dstW, j1 - j0));
+		});
+
+		for (int j = b0; j < b1; j++) {
+			e = sink.consume(j, band.row(j - b0)); ree;
+		}
+	}
+
+	return e;
+}
+
+int ScalerDDT::threads() const {
+	return mThreadCount > 0 ? mThreadCount : ThreadPool::instance().threadCount();
+}
+
+pixel ScalerDDT::sampleSlash(const pixel *top, const pixel *bottom, int i, float u, float v) {
+	if (u + v <= 1.0f) {
+		// upper triangle
+		pixel a = top[i];
+		pixel b = top[i + 1];
+		pixel c = bottom[i];
+		return mix3(a, b, c, u, v);
+	} else {
+		// bottom triangle
+		pixel a = bottom[i + 1];
+		pixel b = bottom[i];
+		pixel c = top[i + 1];
+		return mix3(a, b, c, 1.0f - u, 1.0f - v);
+	}
+}
+	
+pixel ScalerDDT::sampleBackslash(const pixel *top, const pixel *bottom, int i, float u, float v) {
+	if (u >= v) {
+		// upper triangle
+		pixel a = top[i + 1];
+		pixel b = top[i];
+		pixel c = bottom[i + 1];
+		return mix3(a, b, c, 1.0f - u, v);
+	} else {
+		// bottom triangle
+		pixel a = bottom[i];
+		pixel b = bottom[i + 1];
+		pixel c = top[i];
+		return mix3(a, b, c, u, 1.0f - v);
+	}
+}
+
+pixel ScalerDDT::mix3(pixel a, pixel b, pixel c, float u, float v) {
+	// unpack a
+	float ar = R(a);
+	float ag = G(a);
+	float ab = B(a);
+
+	// unpack b
+	float br = R(b);
+	float bg = G(b);
+	float bb = B(b);
+
+	// unpack c
+	float cr = R(c);
+	float cg = G(c);
+	float cb = B(c);
+
+	// cache
+	float omu = 1.0f - u;
+	float omv = 1.0f - v;
+
+	// mix horizontally
+	float r1 = ar * omu + br * u;
+	float r2 = cr * omu + br * u;
+	float g1 = ag * omu + bg * u;
+	float g2 = cg * omu + bg * u;
+	float b1 = ab * omu + bb * u;
+	float b2 = cb * omu + bb * u;
+
+	// mix vertically
+	float fr = r1 * omv + r2 * v;
+	float fg = g1 * omv + g2 * v;
+	float fb = b1 * omv + b2 * v;
+
+	// Convert to integer
+	comp finalR = (comp)std::max(0.0f, std::min(255.0f, fr));
+	comp finalG = (comp)std::max(0.0f, std::min(255.0f, fg));
+	comp finalB = (comp)std::max(0.0f, std::min(255.0f, fb));
+
+	// re-pack
+	pixel ret = RGB(finalR, finalG, finalB);
+
+	return ret;
 }
\ No newline at end of file
@@ -1,50 +1,103 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#ifndef __SCALER_DDT_H__
-#define __SCALER_DDT_H__
-
-#include "Scaler.h"
-
-// TODO: Remove
-#include "../common/Image.h"
-
-class ScalerDDT : public Scaler {
-public:
-	ScalerDDT();
-	virtual ~ScalerDDT();
-
-public:
-	Err scale(const Image &src, int dstW, int dstH, Image *dst) override;
-
-private:
-	std::vector<bool> edges;
-
-private:
-	Err createEdges(const Image &src);
-	pixel bilinear(const Image &src, int i, int dstW, int j, int dstH);
-	pixel sampleSlash(const Image &src, int i, int j, float u, float v);
-	pixel sampleBackslash(const Image &src, int i, int j, float u, float v);
-	static pixel mix3(pixel a, pixel b, pixel c, float u, float v);
-};
-
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __SCALER_DDT_H__
+#define __SCALER_DDT_H__
+
+#include "Scaler.h"
+
+// TODO: Remove
+#include "../common/Image.h"
+#include "../common/ImageView.h"
+
+class ScalerDDT : public Scaler {
+public:
+	ScalerDDT();
+	virtual ~ScalerDDT();
+
+public:
+	using Scaler::scale;
+	Err scale(const ConstImageView &src, const ImageView &dst) override;
+
+	/*!
+	\brief Receives the output of scaleRows() one row at a time.
+	*/
+	class RowSink {
+	public:
+		virtual ~RowSink() {}
+
+		/*!
+		\brief Called for rows 0 to h - 1 in order. row is only valid during the call;
+		anything but Err::Success stops the scale and is passed on to the caller.
+		*/
+		virtual Err consume(int y, const pixel *row) = 0;
+	};
+
+	/*!
+	\brief Scales src to dstW x dstH, handing each output row to sink as soon as it is done.
+	Only three rows of the edge map and two source rows are held at a time,
+	so memory does not grow with the height of the image.
+	*/
+	Err scaleRows(const ConstImageView &src, int dstW, int dstH, RowSink &sink);
+
+	/*!
+	\brief Threads a scale may use, the calling one included; 0 means one per hardware thread.
+	Output rows are split between the threads, and the result does not depend on how many there are.
+	*/
+	void setThreadCount(int threadCount) { mThreadCount = std::max(0, threadCount); }
+	int threadCount() const { return mThreadCount; }
+
+	/*!
+	\brief Where one destination column (or row) samples the source.
+	*/
+	struct AxisSample {
+		// top-left source pixel of the triangulated quad; the quad may reach into the guard band
+		int s;
+		// the quad's entry in the edge map, clamped to the map
+		int e;
+		// position inside the quad, in [0, 1)
+		float f;
+		// f in 15-bit fixed point, at most FIXED_ONE - 1
+		int q;
+	};
+
+	//! 1.0 in the fixed-point weights of the SIMD sampler
+	static const int FIXED_ONE = 1 << 15;
+
+private:
+	// Produces output rows on one thread
+	class RowSampler;
+
+	// Output rows each thread produces per band in scaleRows()
+	static const int BAND_ROWS = 32;
+
+	int mThreadCount;
+
+private:
+	int threads() const;
+	static void mapAxis(int srcSize, int dstSize, AxisSample *out);
+	static pixel sampleSlash(const pixel *top, const pixel *bottom, int i, float u, float v);
+	static pixel sampleBackslash(const pixel *top, const pixel *bottom, int i, float u, float v);
+	static pixel mix3(pixel a, pixel b, pixel c, float u, float v);
+};
+
 #endif // ndef __SCALER_DDT_H__
\ No newline at end of file
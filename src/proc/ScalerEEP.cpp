@@ -1,190 +1,486 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#include <algorithm>
-
-#include "ScalerEEP.h"
-
-#include "../common/common.h"
-
-static inline int pixelDiff(pixel a, pixel b) {
-	int ret = 0;
-
-	ret += abs(R(a) - R(b));
-	ret += abs(G(a) - G(b));
-	ret += abs(B(a) - B(b));
-
-	return ret;
-}
-
-static inline int pixelAverage(pixel x, pixel y) {
-	comp r = (R(x) + R(y)) >> 1;
-	comp g = (G(x) + G(y)) >> 1;
-	comp b = (B(x) + B(y)) >> 1;
-	return RGB(r, g, b);
-}
-
-static inline int pixelAverageWeighed(pixel x, pixel y, int w) {
-	int omw = 256 - w;
-
-	comp r = (R(x) * w + R(y) * omw) >> 8;
-	comp g = (G(x) * w + G(y) * omw) >> 8;
-	comp b = (B(x) * w + B(y) * omw) >> 8;
-	return RGB(r, g, b);
-}
-
-ScalerEEP::ScalerEEP() {
-
-}
-
-ScalerEEP::~ScalerEEP() {
-
-}
-
-
-Err ScalerEEP::scale2x(const Image &src, Image *dst) {
-	Err e = Err::Success;
-
-	dst->setSize(src.w() * 2, src.h() * 2);
-
-	// fill all destination pixels
-	for (int j = 1; j < dst->h(); j++) {
-		for (int i = 1; i < dst->w(); i++) {
-			int category = ((i & 1) << 1) | (j & 1);
-
-			pixel p;
-
-			switch (category) {
-			case 0:
-				// 00 : even-even
-				p = sampleEvenEven(src, i, j);
-				break;
-			case 1:
-				// 01 : even-odd
-				p = sampleEvenOdd(src, i, j);
-				break;
-			case 2:
-				// 10 : odd-even
-				p = sampleOddEven(src, i, j);
-				break;
-			case 3:
-				// 11 : odd-odd
-				p = sampleOddOdd(src, i, j);
-				break;
-			}
-
-			dst->setPixel(i, j, p);
-		}
-	}
-
-	return e;
-}
-
-pixel ScalerEEP::sampleEvenEven(const Image &src, int i, int j) const {
-	return src.getPixel(i/2, j/2);
-}
-
-// This gives 4x the weight to the closer pixels and 1/4th the weight to the other pixels having twice the distance.
-static const int evenOddWeight = 205;
-
-pixel ScalerEEP::sampleEvenOdd(const Image &src, int i, int j) const {
-	int srcI = i / 2;
-	int srcJ = j / 2;
-
-	pixel a = pixelAverage(src.getPixel(srcI, srcJ), src.getPixel(srcI, srcJ + 1));
-	pixel b1 = pixelAverage(src.getPixel(srcI - 1, srcJ), src.getPixel(srcI - 1, srcJ + 1));
-	pixel b2 = pixelAverage(src.getPixel(srcI + 1, srcJ), src.getPixel(srcI + 1, srcJ + 1));
-	pixel b = pixelAverage(b1, b2);
-
-	return pixelAverageWeighed(a, b, evenOddWeight);
-}
-
-pixel ScalerEEP::sampleOddEven(const Image &src, int i, int j) const {
-	int srcI = i / 2;
-	int srcJ = j / 2;
-
-	pixel a = pixelAverage(src.getPixel(srcI, srcJ), src.getPixel(srcI+1, srcJ));
-	pixel b1 = pixelAverage(src.getPixel(srcI, srcJ - 1), src.getPixel(srcI + 1, srcJ - 1));
-	pixel b2 = pixelAverage(src.getPixel(srcI, srcJ + 1), src.getPixel(srcI + 1, srcJ + 1));
-	pixel b = pixelAverage(b1, b2);
-
-	return pixelAverageWeighed(a, b, evenOddWeight);
-}
-
-pixel ScalerEEP::sampleOddOdd(const Image &src, int i, int j) const {
-	// Get the diagonal neighbours
-	// A   B
-	//   X  
-	// C   D
-
-	int ai = i / 2;
-	int aj = j / 2;
-
-	pixel a = src.getPixel(ai, aj);
-	pixel b = src.getPixel(ai + 1, aj);
-	pixel c = src.getPixel(ai, aj + 1);
-	pixel d = src.getPixel(ai + 1, aj + 1);
-
-	// calculate diffs
-	int diffAD = pixelDiff(a, d);
-	int diffBC = pixelDiff(b, c);
-
-	if (diffAD == diffBC && diffAD == 0) {
-		// all pixels are the same
-		return a;
-	}
-
-	// calculate averages
-	pixel avgAD = pixelAverage(a, d);
-	pixel avgBC = pixelAverage(b, c);
-
-	// if one diagonal has zero diff, use that
-	if (diffAD == 0) {
-		return avgAD;
-	}
-	if (diffBC == 0) {
-		return avgBC;
-	}
-
-	int smallDiff, largeDiff;
-	pixel smallDiffAvg, largeDiffAvg;
-
-	if (diffAD < diffBC) {
-		smallDiff = diffAD;
-		largeDiff = diffBC;
-		smallDiffAvg = avgAD;
-		largeDiffAvg = avgBC;
-	} else {
-		smallDiff = diffBC;
-		largeDiff = diffAD;
-		smallDiffAvg = avgBC;
-		largeDiffAvg = avgAD;
-	}
-	
-	// calculate weight W
-	float W = 1.0f / (1.0f + ((float)largeDiff / (float)smallDiff));
-
-	// convert W to [0, 256] range as an optimization
-	int wi = (comp) std::max(0.0f, std::min(256.0f, (W * 256.0f)));
-
-	return pixelAverageWeighed(largeDiffAvg, smallDiffAvg, wi);
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "ScalerEEP.h"
+
+#include "../common/common.h"
+#include "../common/Cpu.h"
+
+#ifdef UPSCALE_X86
+#include <immintrin.h>
+#endif
+
+static inline int pixelDiff(pixel a, pixel b) {
+	int ret = 0;
+
+	ret += abs(R(a) - R(b));
+	ret += abs(G(a) - G(b));
+	ret += abs(B(a) - B(b));
+
+	return ret;
+}
+
+static inline int pixelAverage(pixel x, pixel y) {
+	comp r = (R(x) + R(y)) >> 1;
+	comp g = (G(x) + G(y)) >> 1;
+	comp b = (B(x) + B(y)) >> 1;
+	return RGB(r, g, b);
+}
+
+static inline int pixelAverageWeighed(pixel x, pixel y, int w) {
+	int omw = 256 - w;
+
+	comp r = (R(x) * w + R(y) * omw) >> 8;
+	comp g = (G(x) * w + G(y) * omw) >> 8;
+	comp b = (B(x) * w + B(y) * omw) >> 8;
+	return RGB(r, g, b);
+}
+
+ScalerEEP::ScalerEEP() {
+	// The fused cascade is exact for EEP, so it is on by default
+	setFusedTileSize(FUSED_TILE_SIZE);
+
+}
+
+ScalerEEP::~ScalerEEP() {
+
+}
+
+
+Err ScalerEEP::scale2x(const ConstImageView &src, Image *dst) {
+	Err e = Err::Success;
+
+	int w = src.w();
+	int h = src.h();
+
+	// Every destination pixel is computed below; nothing needs to be kept
+	dst->setSizeDiscard(w * 2, h * 2);
+
+	ImageView out(*dst);
+
+	if (w <= 0 || h <= 0) {
+		return e;
+	}
+
+	PixelBuffer cache(cacheSize(w));
+	scaleRows(src, cache.data(), out);
+
+	return e;
+}
+
+// This gives 4x the weight to the closer pixels and 1/4th the weight to the other pixels having twice the distance.
+static const int evenOddWeight = 205;
+
+static inline pixel sampleOddOdd(pixel a, pixel b, pixel c, pixel d) {
+	// Get the diagonal neighbours
+	// A   B
+	//   X  
+	// C   D
+
+	// calculate diffs
+	int diffAD = pixelDiff(a, d);
+	int diffBC = pixelDiff(b, c);
+
+	if (diffAD == diffBC && diffAD == 0) {
+		// all pixels are the same
+		return a;
+	}
+
+	// calculate averages
+	pixel avgAD = pixelAverage(a, d);
+	pixel avgBC = pixelAverage(b, c);
+
+	// if one diagonal has zero diff, use that
+	if (diffAD == 0) {
+		return avgAD;
+	}
+	if (diffBC == 0) {
+		return avgBC;
+	}
+
+	int smallDiff, largeDiff;
+	pixel smallDiffAvg, largeDiffAvg;
+
+	if (diffAD < diffBC) {
+		smallDiff = diffAD;
+		largeDiff = diffBC;
+		smallDiffAvg = avgAD;
+		largeDiffAvg = avgBC;
+	} else {
+		smallDiff = diffBC;
+		largeDiff = diffAD;
+		smallDiffAvg = avgBC;
+		largeDiffAvg = avgAD;
+	}
+	
+	// calculate weight W
+	float W = 1.0f / (1.0f + ((float)largeDiff / (float)smallDiff));
+
+	// convert W to [0, 256] range as an optimization
+	int wi = (comp) std::max(0.0f, std::min(256.0f, (W * 256.0f)));
+
+	return pixelAverageWeighed(largeDiffAvg, smallDiffAvg, wi);
+}
+
+// Row caches. Every output row pair is assembled from
+// - H: horizontal pair averages avg(s(x, y), s(x + 1, y)) of the rows above, at and below
+// - V: vertical pair averages avg(s(x, y), s(x, y + 1)), from x = -1 to x = w
+// - Q: the odd-odd sample of every 2x2 quad
+// The odd-even output is weighed from H(y) and avg(H(y - 1), H(y + 1)), the
+// even-odd output from V(x) and avg(V(x - 1), V(x + 1)). Each H row is
+// computed once and used by three row pairs, each V entry by three pixels.
+
+static void pairAveragesScalar(const pixel *a, const pixel *b, int n, pixel *out) {
+	for (int x = 0; x < n; x++) {
+		out[x] = pixelAverage(a[x], b[x]);
+	}
+}
+
+static void oddOddRowScalar(const pixel *row, const pixel *below, int n, pixel *out) {
+	for (int x = 0; x < n; x++) {
+		out[x] = sampleOddOdd(row[x], row[x + 1], below[x], below[x + 1]);
+	}
+}
+
+static void assembleRowPairScalar(const pixel *row, const pixel *hAbove, const pixel *hRow, const pixel *hBelow,
+	const pixel *v, const pixel *q, int n, pixel *evenOut, pixel *oddOut) {
+	for (int x = 0; x < n; x++) {
+		evenOut[2 * x] = row[x];
+		evenOut[2 * x + 1] = pixelAverageWeighed(hRow[x], pixelAverage(hAbove[x], hBelow[x]), evenOddWeight);
+		oddOut[2 * x] = pixelAverageWeighed(v[x], pixelAverage(v[x - 1], v[x + 1]), evenOddWeight);
+		oddOut[2 * x + 1] = q[x];
+	}
+}
+
+#ifdef UPSCALE_X86
+
+// The vector kernels below compute the same thing as the samplers above, for
+// 4 (SSE2) or 8 (AVX2) source pixels at a time:
+// - averages are per-byte floor averages, (a & b) + ((a ^ b) >> 1)
+// - weighted averages are done in 16-bit lanes, where x * w + y * (256 - w)
+//   cannot overflow, so they are exact
+// - the odd-odd weight uses the same float operations as sampleOddOdd, and the
+//   early outs of sampleOddOdd fall out of the general case once the diagonal
+//   with the smaller (or equal) diff is taken as the small one
+// The only difference is that the unused low byte of every pixel is zero,
+// except for the copied even-even pixels.
+
+TARGET_SSE2 static inline __m128i loadPixels(const pixel *p) {
+	return _mm_and_si128(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi32((int)0xFFFFFF00));
+}
+
+TARGET_SSE2 static inline __m128i average(__m128i a, __m128i b) {
+	__m128i half = _mm_and_si128(_mm_srli_epi32(_mm_xor_si128(a, b), 1), _mm_set1_epi32(0x7F7F7F00));
+	return _mm_add_epi32(_mm_and_si128(a, b), half);
+}
+
+// (x * w + y * (256 - w)) >> 8 per component; w holds the weights of the
+// pixels in the low and high halves, already spread over 16-bit lanes
+TARGET_SSE2 static inline __m128i averageWeighed(__m128i x, __m128i y, __m128i wLo, __m128i wHi) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i full = _mm_set1_epi16(256);
+
+	__m128i lo = _mm_add_epi16(
+		_mm_mullo_epi16(_mm_unpacklo_epi8(x, zero), wLo),
+		_mm_mullo_epi16(_mm_unpacklo_epi8(y, zero), _mm_sub_epi16(full, wLo)));
+	__m128i hi = _mm_add_epi16(
+		_mm_mullo_epi16(_mm_unpackhi_epi8(x, zero), wHi),
+		_mm_mullo_epi16(_mm_unpackhi_epi8(y, zero), _mm_sub_epi16(full, wHi)));
+
+	return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+// Sum of absolute component differences of each pixel pair
+TARGET_SSE2 static inline __m128i difference(__m128i a, __m128i b) {
+	const __m128i lowBytes = _mm_set1_epi16(0xFF);
+	__m128i ad = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+	__m128i pairs = _mm_add_epi16(_mm_and_si128(ad, lowBytes), _mm_and_si128(_mm_srli_epi16(ad, 8), lowBytes));
+	return _mm_madd_epi16(pairs, _mm_set1_epi16(1));
+}
+
+TARGET_SSE2 static inline __m128i selectPixels(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+TARGET_SSE2 static inline __m128i sampleOddOdd(__m128i a, __m128i b, __m128i c, __m128i d) {
+	__m128i diffAD = difference(a, d);
+	__m128i diffBC = difference(b, c);
+	__m128i avgAD = average(a, d);
+	__m128i avgBC = average(b, c);
+
+	__m128i bcSmaller = _mm_cmpgt_epi32(diffAD, diffBC);
+	__m128i smallDiff = selectPixels(bcSmaller, diffBC, diffAD);
+	__m128i largeDiff = selectPixels(bcSmaller, diffAD, diffBC);
+	__m128i smallDiffAvg = selectPixels(bcSmaller, avgBC, avgAD);
+	__m128i largeDiffAvg = selectPixels(bcSmaller, avgAD, avgBC);
+
+	// W = 1 / (1 + large / small) never exceeds 1/2, so no clamping is needed;
+	// a zero small diff means W = 0 (or 0 / 0 when both diffs are zero)
+	const __m128 one = _mm_set1_ps(1.0f);
+	__m128 ratio = _mm_div_ps(_mm_cvtepi32_ps(largeDiff), _mm_cvtepi32_ps(smallDiff));
+	__m128 W = _mm_div_ps(one, _mm_add_ps(one, ratio));
+	__m128i wi = _mm_cvttps_epi32(_mm_mul_ps(W, _mm_set1_ps(256.0f)));
+	wi = _mm_andnot_si128(_mm_cmpeq_epi32(smallDiff, _mm_setzero_si128()), wi);
+
+	wi = _mm_or_si128(wi, _mm_slli_epi32(wi, 16));
+	return averageWeighed(largeDiffAvg, smallDiffAvg, _mm_unpacklo_epi32(wi, wi), _mm_unpackhi_epi32(wi, wi));
+}
+
+// Interleaves a and b pixel by pixel into 8 consecutive pixels
+TARGET_SSE2 static inline void storeInterleaved(pixel *dst, __m128i a, __m128i b) {
+	_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi32(a, b));
+	_mm_storeu_si128((__m128i *)(dst + 4), _mm_unpackhi_epi32(a, b));
+}
+
+TARGET_SSE2 static int pairAveragesSSE2(const pixel *a, const pixel *b, int n, pixel *out) {
+	int x = 0;
+	for (; x + 4 <= n; x += 4) {
+		_mm_storeu_si128((__m128i *)(out + x), average(loadPixels(a + x), loadPixels(b + x)));
+	}
+	return x;
+}
+
+TARGET_SSE2 static int oddOddRowSSE2(const pixel *row, const pixel *below, int n, pixel *out) {
+	int x = 0;
+	for (; x + 4 <= n; x += 4) {
+		__m128i oo = sampleOddOdd(loadPixels(row + x), loadPixels(row + x + 1), loadPixels(below + x), loadPixels(below + x + 1));
+		_mm_storeu_si128((__m128i *)(out + x), oo);
+	}
+	return x;
+}
+
+TARGET_SSE2 static int assembleRowPairSSE2(const pixel *row, const pixel *hAbove, const pixel *hRow, const pixel *hBelow,
+	const pixel *v, const pixel *q, int n, pixel *evenOut, pixel *oddOut) {
+	const __m128i weight = _mm_set1_epi16(evenOddWeight);
+
+	int x = 0;
+	for (; x + 4 <= n; x += 4) {
+		// the caches hold averages, whose low byte is already zero
+		__m128i ee = _mm_loadu_si128((const __m128i *)(row + x));
+		__m128i hr = _mm_loadu_si128((const __m128i *)(hRow + x));
+		__m128i ha = _mm_loadu_si128((const __m128i *)(hAbove + x));
+		__m128i hb = _mm_loadu_si128((const __m128i *)(hBelow + x));
+		__m128i vc = _mm_loadu_si128((const __m128i *)(v + x));
+		__m128i vl = _mm_loadu_si128((const __m128i *)(v + x - 1));
+		__m128i vr = _mm_loadu_si128((const __m128i *)(v + x + 1));
+		__m128i oo = _mm_loadu_si128((const __m128i *)(q + x));
+
+		__m128i oe = averageWeighed(hr, average(ha, hb), weight, weight);
+		__m128i eo = averageWeighed(vc, average(vl, vr), weight, weight);
+
+		storeInterleaved(evenOut + 2 * x, ee, oe);
+		storeInterleaved(oddOut + 2 * x, eo, oo);
+	}
+	return x;
+}
+
+TARGET_AVX2 static inline __m256i loadPixels8(const pixel *p) {
+	return _mm256_and_si256(_mm256_loadu_si256((const __m256i *)p), _mm256_set1_epi32((int)0xFFFFFF00));
+}
+
+TARGET_AVX2 static inline __m256i average(__m256i a, __m256i b) {
+	__m256i half = _mm256_and_si256(_mm256_srli_epi32(_mm256_xor_si256(a, b), 1), _mm256_set1_epi32(0x7F7F7F00));
+	return _mm256_add_epi32(_mm256_and_si256(a, b), half);
+}
+
+TARGET_AVX2 static inline __m256i averageWeighed(__m256i x, __m256i y, __m256i wLo, __m256i wHi) {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i full = _mm256_set1_epi16(256);
+
+	// unpack and pack both work within 128-bit lanes, so the pixel order survives
+	__m256i lo = _mm256_add_epi16(
+		_mm256_mullo_epi16(_mm256_unpacklo_epi8(x, zero), wLo),
+		_mm256_mullo_epi16(_mm256_unpacklo_epi8(y, zero), _mm256_sub_epi16(full, wLo)));
+	__m256i hi = _mm256_add_epi16(
+		_mm256_mullo_epi16(_mm256_unpackhi_epi8(x, zero), wHi),
+		_mm256_mullo_epi16(_mm256_unpackhi_epi8(y, zero), _mm256_sub_epi16(full, wHi)));
+
+	return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+TARGET_AVX2 static inline __m256i difference(__m256i a, __m256i b) {
+	const __m256i lowBytes = _mm256_set1_epi16(0xFF);
+	__m256i ad = _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+	__m256i pairs = _mm256_add_epi16(_mm256_and_si256(ad, lowBytes), _mm256_and_si256(_mm256_srli_epi16(ad, 8), lowBytes));
+	return _mm256_madd_epi16(pairs, _mm256_set1_epi16(1));
+}
+
+TARGET_AVX2 static inline __m256i sampleOddOdd(__m256i a, __m256i b, __m256i c, __m256i d) {
+	__m256i diffAD = difference(a, d);
+	__m256i diffBC = difference(b, c);
+	__m256i avgAD = average(a, d);
+	__m256i avgBC = average(b, c);
+
+	__m256i bcSmaller = _mm256_cmpgt_epi32(diffAD, diffBC);
+	__m256i smallDiff = _mm256_blendv_epi8(diffAD, diffBC, bcSmaller);
+	__m256i largeDiff = _mm256_blendv_epi8(diffBC, diffAD, bcSmaller);
+	__m256i smallDiffAvg = _mm256_blendv_epi8(avgAD, avgBC, bcSmaller);
+	__m256i largeDiffAvg = _mm256_blendv_epi8(avgBC, avgAD, bcSmaller);
+
+	const __m256 one = _mm256_set1_ps(1.0f);
+	__m256 ratio = _mm256_div_ps(_mm256_cvtepi32_ps(largeDiff), _mm256_cvtepi32_ps(smallDiff));
+	__m256 W = _mm256_div_ps(one, _mm256_add_ps(one, ratio));
+	__m256i wi = _mm256_cvttps_epi32(_mm256_mul_ps(W, _mm256_set1_ps(256.0f)));
+	wi = _mm256_andnot_si256(_mm256_cmpeq_epi32(smallDiff, _mm256_setzero_si256()), wi);
+
+	wi = _mm256_or_si256(wi, _mm256_slli_epi32(wi, 16));
+	return averageWeighed(largeDiffAvg, smallDiffAvg, _mm256_unpacklo_epi32(wi, wi), _mm256_unpackhi_epi32(wi, wi));
+}
+
+// Interleaves a and b pixel by pixel into 16 consecutive pixels
+TARGET_AVX2 static inline void storeInterleaved(pixel *dst, __m256i a, __m256i b) {
+	__m256i lo = _mm256_unpacklo_epi32(a, b);
+	__m256i hi = _mm256_unpackhi_epi32(a, b);
+	_mm256_storeu_si256((__m256i *)dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+	_mm256_storeu_si256((__m256i *)(dst + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+TARGET_AVX2 static int pairAveragesAVX2(const pixel *a, const pixel *b, int n, pixel *out) {
+	int x = 0;
+	for (; x + 8 <= n; x += 8) {
+		_mm256_storeu_si256((__m256i *)(out + x), average(loadPixels8(a + x), loadPixels8(b + x)));
+	}
+	return x;
+}
+
+TARGET_AVX2 static int oddOddRowAVX2(const pixel *row, const pixel *below, int n, pixel *out) {
+	int x = 0;
+	for (; x + 8 <= n; x += 8) {
+		__m256i oo = sampleOddOdd(loadPixels8(row + x), loadPixels8(row + x + 1), loadPixels8(below + x), loadPixels8(below + x + 1));
+		_mm256_storeu_si256((__m256i *)(out + x), oo);
+	}
+	return x;
+}
+
+TARGET_AVX2 static int assembleRowPairAVX2(const pixel *row, const pixel *hAbove, const pixel *hRow, const pixel *hBelow,
+	const pixel *v, const pixel *q, int n, pixel *evenOut, pixel *oddOut) {
+	const __m256i weight = _mm256_set1_epi16(evenOddWeight);
+
+	int x = 0;
+	for (; x + 8 <= n; x += 8) {
+		__m256i ee = _mm256_loadu_si256((const __m256i *)(row + x));
+		__m256i hr = _mm256_loadu_si256((const __m256i *)(hRow + x));
+		__m256i ha = _mm256_loadu_si256((const __m256i *)(hAbove + x));
+		__m256i hb = _mm256_loadu_si256((const __m256i *)(hBelow + x));
+		__m256i vc = _mm256_loadu_si256((const __m256i *)(v + x));
+		__m256i vl = _mm256_loadu_si256((const __m256i *)(v + x - 1));
+		__m256i vr = _mm256_loadu_si256((const __m256i *)(v + x + 1));
+		__m256i oo = _mm256_loadu_si256((const __m256i *)(q + x));
+
+		__m256i oe = averageWeighed(hr, average(ha, hb), weight, weight);
+		__m256i eo = averageWeighed(vc, average(vl, vr), weight, weight);
+
+		storeInterleaved(evenOut + 2 * x, ee, oe);
+		storeInterleaved(oddOut + 2 * x, eo, oo);
+	}
+	return x;
+}
+
+#endif // def UPSCALE_X86
+
+static void pairAverages(const pixel *a, const pixel *b, int n, pixel *out) {
+	int x = 0;
+
+#ifdef UPSCALE_X86
+	SimdLevel level = simdLevel();
+	if (level >= SimdLevel::AVX2) {
+		x = pairAveragesAVX2(a, b, n, out);
+	} else if (level >= SimdLevel::SSE2) {
+		x = pairAveragesSSE2(a, b, n, out);
+	}
+#endif
+
+	pairAveragesScalar(a + x, b + x, n - x, out + x);
+}
+
+static void oddOddRow(const pixel *row, const pixel *below, int n, pixel *out) {
+	int x = 0;
+
+#ifdef UPSCALE_X86
+	SimdLevel level = simdLevel();
+	if (level >= SimdLevel::AVX2) {
+		x = oddOddRowAVX2(row, below, n, out);
+	} else if (level >= SimdLevel::SSE2) {
+		x = oddOddRowSSE2(row, below, n, out);
+	}
+#endif
+
+	oddOddRowScalar(row + x, below + x, n - x, out + x);
+}
+
+static void assembleRowPair(const pixel *row, const pixel *hAbove, const pixel *hRow, const pixel *hBelow,
+	const pixel *v, const pixel *q, int n, pixel *evenOut, pixel *oddOut) {
+	int x = 0;
+
+#ifdef UPSCALE_X86
+	SimdLevel level = simdLevel();
+	if (level >= SimdLevel::AVX2) {
+		x = assembleRowPairAVX2(row, hAbove, hRow, hBelow, v, q, n, evenOut, oddOut);
+	} else if (level >= SimdLevel::SSE2) {
+		x = assembleRowPairSSE2(row, hAbove, hRow, hBelow, v, q, n, evenOut, oddOut);
+	}
+#endif
+
+	assembleRowPairScalar(row + x, hAbove + x, hRow + x, hBelow + x, v + x, q + x, n - x, evenOut + 2 * x, oddOut + 2 * x);
+}
+
+// Row y of src; rows outside the image repeat the nearest edge row
+static inline const pixel *sourceRow(const ConstImageView &src, int y) {
+	return src.row(std::max(0, std::min(src.h() - 1, y)));
+}
+
+static void horizontalAverages(const pixel *row, int w, pixel *out) {
+	pairAverages(row, row + 1, w - 1, out);
+	out[w - 1] = pixelAverage(row[w - 1], row[w - 1]);
+}
+
+void ScalerEEP::scaleRows(const ConstImageView &src, pixel *cache, const ImageView &out) {
+	int w = src.w();
+	int h = src.h();
+
+	// H rows of y - 1, y and y + 1 live in slot (y + 3) % 3
+	pixel *hRows[3] = { cache, cache + w, cache + 2 * w };
+	pixel *v = cache + 3 * w + 1;
+	pixel *q = cache + 4 * w + 2;
+
+	horizontalAverages(sourceRow(src, -1), w, hRows[2]);
+	horizontalAverages(sourceRow(src, 0), w, hRows[0]);
+
+	for (int y = 0; y < h; y++) {
+		const pixel *row = sourceRow(src, y);
+		const pixel *below = sourceRow(src, y + 1);
+
+		horizontalAverages(below, w, hRows[(y + 1) % 3]);
+
+		pairAverages(row, below, w, v);
+		v[-1] = v[0];
+		v[w] = v[w - 1];
+
+		oddOddRow(row, below, w - 1, q);
+		q[w - 1] = sampleOddOdd(row[w - 1], row[w - 1], below[w - 1], below[w - 1]);
+
+		assembleRowPair(row, hRows[(y + 2) % 3], hRows[y % 3], hRows[(y + 1) % 3], v, q, w,
+			out.row(y * 2), out.row(y * 2 + 1));
+	}
 }
\ No newline at end of file
@@ -1,229 +1,692 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#include <algorithm>
-
-#include "ScalerSelfSim2x.h"
-
-#include "../common/common.h"
-
-#define PATCH_SIZE 5
-#define PATCH_SEARCH_SIZE 11
-
-namespace {
-	class Patch {
-
-	};
-}
-
-
-
-ScalerSelfSim2x::ScalerSelfSim2x() {
-
-}
-
-ScalerSelfSim2x::~ScalerSelfSim2x() {
-
-}
-
-
-static lcomp diffPatch(const ImageChannels &small, int smallPatchX, int smallPatchY,
-	const ImageChannels &large, int largePatchX, int largePatchY) {
-
-	int stride0 = small.w();
-	int pixel0X = smallPatchX - PATCH_SIZE / 2;
-	int pixel0Y = smallPatchY - PATCH_SIZE / 2;
-	int pixel0 = pixel0X + stride0 * pixel0Y;
-	const lcomp *r0 = &small.red[pixel0];
-	const lcomp *g0 = &small.green[pixel0];
-	const lcomp *b0 = &small.blue[pixel0];
-
-	int stride1 = large.w();
-	int pixel1X = largePatchX - PATCH_SIZE / 2;
-	int pixel1Y = largePatchY - PATCH_SIZE / 2;
-	int pixel1 = pixel1X + stride1 * pixel1Y;
-	const lcomp *r1 = &large.red[pixel1];
-	const lcomp *g1 = &large.green[pixel1];
-	const lcomp *b1 = &large.blue[pixel1];
-
-	lcomp ret = 0;
-	for (int j = 0; j < PATCH_SIZE; j++) {
-		for (int i = 0; i < PATCH_SIZE; i++) {
-			lcomp dr = *r1 - *r0;
-			lcomp dg = *g1 - *g0;
-			lcomp db = *b1 - *b0;
-			//ret += dr * dr + dg * dg + db * db;
-			ret += abs(dr) + abs(dg) + abs(db);
-
-			r0++; g0++; b0++;
-			r1++; g1++; b1++;
-		}
-
-		r0 += stride0 - PATCH_SIZE;
-		g0 += stride0 - PATCH_SIZE;
-		b0 += stride0 - PATCH_SIZE;
-
-		r1 += stride1 - PATCH_SIZE;
-		g1 += stride1 - PATCH_SIZE;
-		b1 += stride1 - PATCH_SIZE;
-	}
-
-	return ret;
-}
-
-static Err locateBestPatch(const ImageChannels &small, const ImageChannels &large,
-	int largePatchX, int largePatchY, int *bestX, int *bestY) {
-	Err e = Err::Success;
-
-	// first, project large image patch to small image
-	int smallPatchX = largePatchX / 2;
-	int smallPatchY = largePatchY / 2;
-
-	// calculate how much freedom the search has
-	int freedom = (PATCH_SEARCH_SIZE - (PATCH_SEARCH_SIZE / 2)) - (PATCH_SIZE - (PATCH_SIZE / 2));
-
-	// define search boundaries
-	int searchStartX = smallPatchX - freedom;
-	int searchStartY = smallPatchY - freedom;
-
-	// search
-	bool first = true;
-	lcomp minDiff;
-	for (int i = searchStartX; i < searchStartX + 2 * freedom; i++) {
-		if (i - PATCH_SIZE / 2 < 0) {
-			continue;
-		}
-		if (i + PATCH_SIZE / 2 >= small.w()) {
-			continue;
-		}
-		for (int j = searchStartY; j < searchStartY + 2 * freedom; j++) {
-			if (j - PATCH_SIZE / 2 < 0) {
-				continue;
-			}
-			if (j + PATCH_SIZE / 2 >= small.h()) {
-				continue;
-			}
-
-			lcomp diff = diffPatch(small, i, j, large, largePatchX, largePatchY);
-
-			if (first || diff < minDiff) {
-				first = false;
-				minDiff = diff;
-				*bestX = i;
-				*bestY = j;
-			}
-		}
-	}
-
-	return e;
-}
-
-static Err applyPatch(const ImageChannels &small, int smallPatchX, int smallPatchY,
-	ImageChannels *large, int largePatchX, int largePatchY) {
-
-	Err e = Err::Success;
-
-	int stride0 = small.w();
-	int pixel0X = smallPatchX - PATCH_SIZE / 2;
-	int pixel0Y = smallPatchY - PATCH_SIZE / 2;
-	int pixel0 = pixel0X + stride0 * pixel0Y;
-	const lcomp *r0 = &small.red[pixel0];
-	const lcomp *g0 = &small.green[pixel0];
-	const lcomp *b0 = &small.blue[pixel0];
-
-	int stride1 = large->w();
-	int pixel1X = largePatchX - PATCH_SIZE / 2;
-	int pixel1Y = largePatchY - PATCH_SIZE / 2;
-	int pixel1 = pixel1X + stride1 * pixel1Y;
-	lcomp *r1 = &large->red[pixel1];
-	lcomp *g1 = &large->green[pixel1];
-	lcomp *b1 = &large->blue[pixel1];
-
-	for (int j = 0; j < PATCH_SIZE; j++) {
-		for (int i = 0; i < PATCH_SIZE; i++) {
-			*r1 += *r0;
-			*g1 += *g0;
-			*b1 += *b0;
-
-			r0++; g0++; b0++;
-			r1++; g1++; b1++;
-		}
-
-		r0 += stride0 - PATCH_SIZE;
-		g0 += stride0 - PATCH_SIZE;
-		b0 += stride0 - PATCH_SIZE;
-		r1 += stride1 - PATCH_SIZE;
-		g1 += stride1 - PATCH_SIZE;
-		b1 += stride1 - PATCH_SIZE;
-	}
-
-	return e;
-}
-
-Err ScalerSelfSim2x::scale2x(const Image &src, Image *dst) {
-	Err e = Err::Success;
-
-	// First, split input image into low and high frequency sub-imags
-	Image tmp1, tmp2, low, high;
-
-	// low-freq is downscaled and then upscaled again
-	e = scaleLinear(src, src.w() / 2, src.h() / 2, &tmp1); ree;
-	e = scaleLinear(tmp1, src.w(), src.h(), &low); ree;
-
-	// Break to channels to process easily
-	ImageChannels srcC(src);
-	ImageChannels lowC(low);
-	ImageChannels highC(srcC - lowC);
-
-	// Now, upsample. This will produce a larger but blurry picture
-	// (Picture with only lower part of the frequency band).
-	Image largeLow;
-	e = scaleLinear(src, src.w() * 2, src.h() * 2, &largeLow); ree;
-	ImageChannels largeLowC(largeLow);
-
-	// Create an empty image (black) upon which we will paste the hi-freq patches (additive paste)
-	ImageChannels largeHighC(largeLowC.w(), largeLowC.h());
-
-	// match each one of the possible 5x5 patches into the blurred version of the small picture
-	for (int i = PATCH_SIZE / 2; i < largeLowC.w() - PATCH_SIZE; i++) {
-
-		for (int j = PATCH_SIZE / 2; j < largeLowC.h() - PATCH_SIZE; j++) {
-			int bestX, bestY;
-			e = locateBestPatch(srcC, largeLowC, i, j, &bestX, &bestY); ree;
-
-			// additively paste the hi-freq patch
-			e = applyPatch(highC, bestX, bestY, &largeHighC, i, j); ree;
-		}
-	}
-
-	// Every pixel in the high freq image has now received the contribution of 5x5 incoming patches. Average.
-	largeHighC /= PATCH_SIZE * PATCH_SIZE;
-
-	// Finally, merge low and high frequency bands of the scaled image
-	ImageChannels largeC = largeLowC + largeHighC;
-
-	// write output
-	*dst = largeC;
-
-	return e;
-}
-
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "ScalerSelfSim2x.h"
+#include "PatchDistance.h"
+
+#include "../common/common.h"
+#include "../common/ScratchArena.h"
+#include "../common/ThreadPool.h"
+
+#define PATCH_SEARCH_SIZE 11
+
+// Candidate patch centres lie -SEARCH_FREEDOM to SEARCH_FREEDOM - 1 pixels from the projected position
+#define SEARCH_FREEDOM ((PATCH_SEARCH_SIZE - (PATCH_SEARCH_SIZE / 2)) - (PATCH_SIZE - (PATCH_SIZE / 2)))
+#define SEARCH_SPAN (2 * SEARCH_FREEDOM)
+
+// Marks a pixel whose candidateIndex() is not known yet
+#define NO_CANDIDATE 0xFF
+
+// Marks an output pixel without any candidate patch, in PatchOffset::x
+#define NO_PATCH INT8_MIN
+
+// Output rows matched and pasted as one unit of work
+#define BAND_ROWS 64
+
+namespace {
+	class Patch {
+
+	};
+
+	// Centre of the best patch of an output pixel (i, j), relative to (i / 2, j / 2) in the small image
+	struct PatchOffset {
+		int8_t x;
+		int8_t y;
+	};
+}
+
+
+
+ScalerSelfSim2x::ScalerSelfSim2x() : mSearch(Search::AllOffsets), mPatchMatchIterations(2), mPatchMatchRadius(3),
+	mCoarseRadius(4), mRefineRadius(1), mThreadCount(1) {
+	setFusedTileSize(FUSED_TILE_SIZE);
+}
+
+ScalerSelfSim2x::~ScalerSelfSim2x() {
+
+}
+
+bool ScalerSelfSim2x::fusable(const ConstImageView &src) const {
+	if (src.w() % 2 != 0 || src.h() % 2 != 0) {
+		return false;
+	}
+	return mSearch == Search::Exhaustive || mSearch == Search::AllOffsets;
+}
+
+
+static Err locateBestPatch(const ImageChannels8 &small, const ImageChannels8 &large,
+	int largePatchX, int largePatchY, int *bestX, int *bestY) {
+	Err e = Err::Success;
+
+	// first, project large image patch to small image
+	int smallPatchX = largePatchX / 2;
+	int smallPatchY = largePatchY / 2;
+
+	// calculate how much freedom the search has
+	int freedom = SEARCH_FREEDOM;
+
+	// define search boundaries
+	int searchStartX = smallPatchX - freedom;
+	int searchStartY = smallPatchY - freedom;
+
+	// the candidate columns whose patch lies inside the small image
+	int startX = std::max(searchStartX, PATCH_SIZE / 2);
+	int endX = std::min(searchStartX + 2 * freedom, small.w() - PATCH_SIZE / 2);
+	if (startX >= endX) {
+		return e;
+	}
+
+	// search a row of candidates at a time (SEARCH_SPAN <= PATCH_ROW_MAX). Ties
+	// go to the leftmost, then topmost candidate, as when visiting column by column.
+	bool first = true;
+	lcomp minDiff = 0;
+	lcomp diffs[PATCH_ROW_MAX];
+	for (int j = searchStartY; j < searchStartY + 2 * freedom; j++) {
+		if (j - PATCH_SIZE / 2 < 0) {
+			continue;
+		}
+		if (j + PATCH_SIZE / 2 >= small.h()) {
+			continue;
+		}
+
+		diffPatchRow(small, startX, j, large, largePatchX, largePatchY, endX - startX, diffs);
+
+		for (int i = startX; i < endX; i++) {
+			lcomp diff = diffs[i - startX];
+
+			if (first || diff < minDiff || (diff == minDiff && i < *bestX)) {
+				first = false;
+				minDiff = diff;
+				*bestX = i;
+				*bestY = j;
+			}
+		}
+	}
+
+	return e;
+}
+
+// Position of a candidate in the search window of an output pixel. Candidates
+// are numbered in the order the exhaustive search visits them, x-major.
+static inline int candidateIndex(int offsetX, int offsetY) {
+	return (offsetX + SEARCH_FREEDOM) * SEARCH_SPAN + (offsetY + SEARCH_FREEDOM);
+}
+
+// For every output pixel in rows [rowBegin, rowEnd), stores the offset of its best patch in best
+static void matchExhaustive(const ImageChannels8 &small, const ImageChannels8 &large, int rowBegin, int rowEnd,
+	PatchOffset *best) {
+	int jBegin = std::max(rowBegin, PATCH_SIZE / 2);
+	int jEnd = std::min(rowEnd, large.h() - PATCH_SIZE);
+
+	for (int i = PATCH_SIZE / 2; i < large.w() - PATCH_SIZE; i++) {
+		for (int j = jBegin; j < jEnd; j++) {
+			int bestX = -1, bestY = -1;
+			locateBestPatch(small, large, i, j, &bestX, &bestY);
+
+			PatchOffset &offset = best[i + large.w() * j];
+			offset.x = bestX < 0 ? NO_PATCH : (int8_t)(bestX - i / 2);
+			offset.y = bestX < 0 ? 0 : (int8_t)(bestY - j / 2);
+		}
+	}
+}
+
+/*
+Same result as matchExhaustive(), organised by shift instead of by output pixel.
+A candidate compares the large patch at (i, j) with the small one at (i - tx, j - ty);
+for a fixed shift (tx, ty) the per-pixel differences are the same whichever
+output pixel's patch they fall in, so they are computed once and summed over
+every 5x5 window with running sums. Each shift is a candidate for a block of
+at most SEARCH_SPAN * 2 output pixels per axis, since the search window moves
+by one small pixel every two large ones. Ties go to the lower candidateIndex(),
+as in the exhaustive search. Only output rows [rowBegin, rowEnd) are matched.
+*/
+template <typename TS, typename TL>
+static void matchAllOffsets(const ImageChannelsT<TS> &small, const ImageChannelsT<TL> &large, int rowBegin, int rowEnd,
+	ScratchArena &scratch, PatchOffset *best) {
+	const int half = PATCH_SIZE / 2;
+	const int F = SEARCH_FREEDOM;
+
+	int largeW = large.w();
+	int smallW = small.w();
+
+	// output pixels that get a patch
+	int iBegin = half, iEnd = large.w() - PATCH_SIZE;
+	int jBegin = std::max(rowBegin, half), jEnd = std::min(rowEnd, large.h() - PATCH_SIZE);
+	if (iBegin >= iEnd || jBegin >= jEnd) {
+		return;
+	}
+
+	// the candidateIndex() and distance of each best patch, for rows jBegin on
+	size_t bandSize = (size_t)largeW * (jEnd - jBegin);
+	uint8_t *bestIndex = scratch.alloc<uint8_t>(bandSize);
+	lcomp *bestDiff = scratch.alloc<lcomp>(bandSize);
+	std::fill_n(bestIndex, bandSize, (uint8_t)NO_CANDIDATE);
+
+	const int maxBlock = 2 * SEARCH_SPAN;
+	const int maxArea = maxBlock + 2 * half;
+	lcomp *diff = scratch.alloc<lcomp>(maxArea * maxArea);
+	lcomp *rowSums = scratch.alloc<lcomp>(maxArea * maxBlock);
+
+	// The shift of candidate offset o from output pixel i is i - (i / 2 + o) = (i - i / 2) - o
+	int txBegin = (iBegin - iBegin / 2) - (F - 1);
+	int txEnd = ((iEnd - 1) - (iEnd - 1) / 2) + F;
+	int tyBegin = (jBegin - jBegin / 2) - (F - 1);
+	int tyEnd = ((jEnd - 1) - (jEnd - 1) / 2) + F;
+
+	for (int ty = tyBegin; ty <= tyEnd; ty++) {
+		// rows with ty in their window whose candidate lies fully inside the small image
+		int j0 = std::max(std::max(jBegin, 2 * (ty - F) - 1), ty + half);
+		int j1 = std::min(std::min(jEnd - 1, 2 * (ty + F - 1)), ty + small.h() - 1 - half);
+		if (j0 > j1) {
+			continue;
+		}
+
+		for (int tx = txBegin; tx <= txEnd; tx++) {
+			int i0 = std::max(std::max(iBegin, 2 * (tx - F) - 1), tx + half);
+			int i1 = std::min(std::min(iEnd - 1, 2 * (tx + F - 1)), tx + smallW - 1 - half);
+			if (i0 > i1) {
+				continue;
+			}
+
+			int blockW = i1 - i0 + 1;
+			int blockH = j1 - j0 + 1;
+			int areaW = blockW + 2 * half;
+			int areaH = blockH + 2 * half;
+
+			// per-pixel difference over the area the block's patches cover
+			for (int y = 0; y < areaH; y++) {
+				int largeRow = (j0 - half + y) * largeW + (i0 - half);
+				int smallRow = (j0 - half + y - ty) * smallW + (i0 - half - tx);
+				lcomp *d = diff + y * areaW;
+				for (int x = 0; x < areaW; x++) {
+					lcomp dr = (lcomp)large.red[largeRow + x] - (lcomp)small.red[smallRow + x];
+					lcomp dg = (lcomp)large.green[largeRow + x] - (lcomp)small.green[smallRow + x];
+					lcomp db = (lcomp)large.blue[largeRow + x] - (lcomp)small.blue[smallRow + x];
+					d[x] = abs(dr) + abs(dg) + abs(db);
+				}
+			}
+
+			// horizontal window sums
+			for (int y = 0; y < areaH; y++) {
+				const lcomp *d = diff + y * areaW;
+				lcomp *out = rowSums + y * blockW;
+
+				lcomp sum = 0;
+				for (int x = 0; x < PATCH_SIZE; x++) {
+					sum += d[x];
+				}
+				out[0] = sum;
+				for (int x = 1; x < blockW; x++) {
+					sum += d[x + PATCH_SIZE - 1] - d[x - 1];
+					out[x] = sum;
+				}
+			}
+
+			// vertical window sums, compared against the best so far
+			for (int x = 0; x < blockW; x++) {
+				int i = i0 + x;
+				int offsetX = (i - tx) - i / 2;
+
+				lcomp sum = 0;
+				for (int y = 0; y < PATCH_SIZE; y++) {
+					sum += rowSums[x + y * blockW];
+				}
+
+				for (int y = 0; y < blockH; y++) {
+					if (y > 0) {
+						sum += rowSums[x + (y + PATCH_SIZE - 1) * blockW] - rowSums[x + (y - 1) * blockW];
+					}
+
+					int j = j0 + y;
+					int index = candidateIndex(offsetX, (j - ty) - j / 2);
+					int p = i + largeW * (j - jBegin);
+
+					if (bestIndex[p] == NO_CANDIDATE || sum < bestDiff[p] || (sum == bestDiff[p] && index < bestIndex[p])) {
+						bestDiff[p] = sum;
+						bestIndex[p] = (uint8_t)index;
+					}
+				}
+			}
+		}
+	}
+
+	for (int j = jBegin; j < jEnd; j++) {
+		for (int i = iBegin; i < iEnd; i++) {
+			int index = bestIndex[i + largeW * (j - jBegin)];
+			PatchOffset &offset = best[i + largeW * j];
+			offset.x = index == NO_CANDIDATE ? NO_PATCH : (int8_t)(index / SEARCH_SPAN - SEARCH_FREEDOM);
+			offset.y = index == NO_CANDIDATE ? 0 : (int8_t)(index % SEARCH_SPAN - SEARCH_FREEDOM);
+		}
+	}
+}
+
+// Deterministic pseudo-random numbers, so the result does not depend on timing or threads
+static inline uint32_t hashRandom(uint32_t x) {
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
+
+/*
+Approximate search after PatchMatch (Barnes et al. 2009). Every output pixel
+starts from a random candidate in its window, then each iteration scans the
+band, alternately forwards and backwards. A pixel tries the match of its
+left and upper neighbours (right and lower when scanning backwards) moved
+by one pixel, since neighbouring patches tend to match neighbouring
+patches. It then tries random candidates around its best one in a window
+halving from the full radius down to one pixel. The window of pixel (i, j)
+spans -radius to radius - 1 small pixels from (i / 2, j / 2). Bands start
+afresh, so the result depends on BAND_ROWS but not on the thread count.
+*/
+static void matchPatchMatch(const ImageChannels8 &small, const ImageChannels8 &large, int rowBegin, int rowEnd,
+	int radius, int iterations, ScratchArena &scratch, PatchOffset *best) {
+	const int half = PATCH_SIZE / 2;
+
+	int largeW = large.w();
+
+	int iBegin = half, iEnd = large.w() - PATCH_SIZE;
+	int jBegin = std::max(rowBegin, half), jEnd = std::min(rowEnd, large.h() - PATCH_SIZE);
+	if (iBegin >= iEnd || jBegin >= jEnd) {
+		return;
+	}
+
+	// the current best patch centre and distance of every pixel in the band
+	size_t bandSize = (size_t)largeW * (jEnd - jBegin);
+	int16_t *bestX = scratch.alloc<int16_t>(bandSize);
+	int16_t *bestY = scratch.alloc<int16_t>(bandSize);
+	lcomp *bestDiff = scratch.alloc<lcomp>(bandSize);
+
+	// window bounds of a pixel, also clamped to the small patches inside the image
+	auto windowX = [&](int i, int *lo, int *hi) {
+		*lo = std::max(i / 2 - radius, half);
+		*hi = std::min(i / 2 + radius - 1, small.w() - half - 1);
+	};
+	auto windowY = [&](int j, int *lo, int *hi) {
+		*lo = std::max(j / 2 - radius, half);
+		*hi = std::min(j / 2 + radius - 1, small.h() - half - 1);
+	};
+
+	for (int j = jBegin; j < jEnd; j++) {
+		int yLo, yHi;
+		windowY(j, &yLo, &yHi);
+
+		for (int i = iBegin; i < iEnd; i++) {
+			int xLo, xHi;
+			windowX(i, &xLo, &xHi);
+
+			int p = i + largeW * (j - jBegin);
+			if (xLo > xHi || yLo > yHi) {
+				bestX[p] = -1;
+				continue;
+			}
+
+			uint32_t r = hashRandom((uint32_t)(j * largeW + i));
+			bestX[p] = (int16_t)(xLo + (int)(r % (uint32_t)(xHi - xLo + 1)));
+			bestY[p] = (int16_t)(yLo + (int)((r >> 16) % (uint32_t)(yHi - yLo + 1)));
+			diffPatchRow(small, bestX[p], bestY[p], large, i, j, 1, &bestDiff[p]);
+		}
+	}
+
+	for (int iteration = 0; iteration < iterations; iteration++) {
+		bool forwards = iteration % 2 == 0;
+		int step = forwards ? 1 : -1;
+
+		for (int jn = 0; jn < jEnd - jBegin; jn++) {
+			int j = forwards ? jBegin + jn : jEnd - 1 - jn;
+			int yLo, yHi;
+			windowY(j, &yLo, &yHi);
+
+			for (int in = 0; in < iEnd - iBegin; in++) {
+				int i = forwards ? iBegin + in : iEnd - 1 - in;
+				int p = i + largeW * (j - jBegin);
+				if (bestX[p] < 0) {
+					continue;
+				}
+
+				int xLo, xHi;
+				windowX(i, &xLo, &xHi);
+
+				auto tryCandidate = [&](int x, int y) {
+					if (x < xLo || x > xHi || y < yLo || y > yHi) {
+						return;
+					}
+					if (x == bestX[p] && y == bestY[p]) {
+						return;
+					}
+					lcomp diff;
+					diffPatchRow(small, x, y, large, i, j, 1, &diff);
+					if (diff < bestDiff[p]) {
+						bestDiff[p] = diff;
+						bestX[p] = (int16_t)x;
+						bestY[p] = (int16_t)y;
+					}
+				};
+
+				// propagation from the neighbours already visited in this scan
+				int ni = i - step;
+				if (ni >= iBegin && ni < iEnd && bestX[p - step] >= 0) {
+					tryCandidate(bestX[p - step] + step, bestY[p - step]);
+				}
+				int nj = j - step;
+				if (nj >= jBegin && nj < jEnd && bestX[p - step * largeW] >= 0) {
+					tryCandidate(bestX[p - step * largeW], bestY[p - step * largeW] + step);
+				}
+
+				// random search around the best so far
+				uint32_t seed = (uint32_t)((iteration + 1) * 0x9e3779b9u) ^ (uint32_t)(j * largeW + i);
+				for (int w = radius; w >= 1; w /= 2) {
+					uint32_t r = hashRandom(seed);
+					seed = r;
+					int x = bestX[p] + (int)(r % (uint32_t)(2 * w + 1)) - w;
+					int y = bestY[p] + (int)((r >> 16) % (uint32_t)(2 * w + 1)) - w;
+					tryCandidate(std::max(xLo, std::min(xHi, x)), std::max(yLo, std::min(yHi, y)));
+				}
+			}
+		}
+	}
+
+	for (int j = jBegin; j < jEnd; j++) {
+		for (int i = iBegin; i < iEnd; i++) {
+			int p = i + largeW * (j - jBegin);
+			PatchOffset &offset = best[i + largeW * j];
+			offset.x = bestX[p] < 0 ? NO_PATCH : (int8_t)(bestX[p] - i / 2);
+			offset.y = bestX[p] < 0 ? 0 : (int8_t)(bestY[p] - j / 2);
+		}
+	}
+}
+
+// Luma (R + 2G + B) / 4 of img, averaged over 2x2 blocks into img.w() / 2 x img.h() / 2 bytes
+static void decimateLuma(const ImageChannels8 &img, uint8_t *out) {
+	int w = img.w() / 2;
+	int h = img.h() / 2;
+
+	for (int y = 0; y < h; y++) {
+		for (int x = 0; x < w; x++) {
+			int sum = 0;
+			for (int dy = 0; dy < 2; dy++) {
+				for (int dx = 0; dx < 2; dx++) {
+					int p = (2 * x + dx) + img.w() * (2 * y + dy);
+					sum += img.red[p] + 2 * img.green[p] + img.blue[p];
+				}
+			}
+			out[x + w * y] = (uint8_t)((sum + 8) / 16);
+		}
+	}
+}
+
+/*
+Coarse to fine. The half-size luma planes from decimateLuma() are searched
+exhaustively first: half-size output pixel (ci, cj) looks -coarseRadius to
+coarseRadius - 1 half-size source pixels from (ci / 2, cj / 2), at a third of
+the channels and a quarter of the pixels of a full-size search. Output pixel
+(i, j) then compares, in colour, every candidate within refineRadius of
+(i / 2, j / 2) and of the full-size position of the match of its half-size
+pixel. The first window catches the close matches the half-size pass misses,
+since it only sees 10x10 areas in luma. Ties go to the first candidate in
+row-major order, around (i / 2, j / 2) first.
+*/
+static void matchHierarchical(const ImageChannels8 &small, const ImageChannels8 &large,
+	const uint8_t *coarseSmall, const uint8_t *coarseLarge, int rowBegin, int rowEnd,
+	int coarseRadius, int refineRadius, ScratchArena &scratch, PatchOffset *best) {
+	const int half = PATCH_SIZE / 2;
+
+	int largeW = large.w();
+	int smallCW = small.w() / 2, smallCH = small.h() / 2;
+	int largeCW = large.w() / 2, largeCH = large.h() / 2;
+
+	int iBegin = half, iEnd = large.w() - PATCH_SIZE;
+	int jBegin = std::max(rowBegin, half), jEnd = std::min(rowEnd, large.h() - PATCH_SIZE);
+	if (iBegin >= iEnd || jBegin >= jEnd || small.w() < PATCH_SIZE || small.h() < PATCH_SIZE) {
+		return;
+	}
+
+	// the half-size matches of the half-size rows under the band; x < 0 where there is none
+	int ciEnd = (iEnd - 1) / 2 + 1;
+	int cjBegin = jBegin / 2, cjEnd = (jEnd - 1) / 2 + 1;
+	int16_t *coarseX = scratch.alloc<int16_t>((size_t)ciEnd * (cjEnd - cjBegin));
+	int16_t *coarseY = scratch.alloc<int16_t>((size_t)ciEnd * (cjEnd - cjBegin));
+
+	lcomp diffs[PATCH_ROW_MAX];
+
+	for (int cj = cjBegin; cj < cjEnd; cj++) {
+		for (int ci = 0; ci < ciEnd; ci++) {
+			int p = ci + ciEnd * (cj - cjBegin);
+			coarseX[p] = -1;
+
+			if (ci < half || ci >= largeCW - half || cj < half || cj >= largeCH - half) {
+				continue;
+			}
+
+			int x0 = std::max(ci / 2 - coarseRadius, half), x1 = std::min(ci / 2 + coarseRadius, smallCW - half);
+			int y0 = std::max(cj / 2 - coarseRadius, half), y1 = std::min(cj / 2 + coarseRadius, smallCH - half);
+
+			lcomp minDiff = 0;
+			for (int y = y0; y < y1; y++) {
+				for (int x = x0; x < x1; x += PATCH_ROW_MAX) {
+					int count = std::min(PATCH_ROW_MAX, x1 - x);
+					diffPatchRowPlane(coarseSmall, smallCW, smallCH, x, y, coarseLarge, largeCW, largeCH, ci, cj, count, diffs);
+
+					for (int k = 0; k < count; k++) {
+						if (coarseX[p] < 0 || diffs[k] < minDiff) {
+							minDiff = diffs[k];
+							coarseX[p] = (int16_t)(x + k);
+							coarseY[p] = (int16_t)y;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	for (int j = jBegin; j < jEnd; j++) {
+		for (int i = iBegin; i < iEnd; i++) {
+			int cp = i / 2 + ciEnd * (j / 2 - cjBegin);
+
+			// around the pixel's own position, then around the match of its half-size pixel moved back to full size
+			int centres = 1;
+			int centreX[2] = { i / 2 }, centreY[2] = { j / 2 };
+			if (coarseX[cp] >= 0) {
+				centreX[1] = 2 * coarseX[cp] + (i & 1);
+				centreY[1] = 2 * coarseY[cp] + (j & 1);
+				centres = centreX[1] != centreX[0] || centreY[1] != centreY[0] ? 2 : 1;
+			}
+
+			int bestX = -1, bestY = -1;
+			lcomp minDiff = 0;
+			for (int c = 0; c < centres; c++) {
+				int x0 = std::max(centreX[c] - refineRadius, half), x1 = std::min(centreX[c] + refineRadius + 1, small.w() - half);
+				int y0 = std::max(centreY[c] - refineRadius, half), y1 = std::min(centreY[c] + refineRadius + 1, small.h() - half);
+
+				for (int y = y0; y < y1; y++) {
+					for (int x = x0; x < x1; x += PATCH_ROW_MAX) {
+						int count = std::min(PATCH_ROW_MAX, x1 - x);
+						diffPatchRow(small, x, y, large, i, j, count, diffs);
+
+						for (int k = 0; k < count; k++) {
+							if (bestX < 0 || diffs[k] < minDiff) {
+								minDiff = diffs[k];
+								bestX = x + k;
+								bestY = y;
+							}
+						}
+					}
+				}
+			}
+
+			PatchOffset &offset = best[i + largeW * j];
+			offset.x = bestX < 0 ? NO_PATCH : (int8_t)(bestX - i / 2);
+			offset.y = bestX < 0 ? 0 : (int8_t)(bestY - j / 2);
+		}
+	}
+}
+
+// Adds the small patch to the large one, leaving out large rows outside [rowBegin, rowEnd)
+template <typename TS, typename TL>
+static void applyPatch(const ImageChannelsT<TS> &small, int smallPatchX, int smallPatchY,
+	ImageChannelsT<TL> *large, int largePatchX, int largePatchY, int rowBegin, int rowEnd) {
+
+	int top = std::max(0, rowBegin - (largePatchY - PATCH_SIZE / 2));
+	int bottom = std::min(PATCH_SIZE, rowEnd - (largePatchY - PATCH_SIZE / 2));
+
+	int stride0 = small.w();
+	int pixel0X = smallPatchX - PATCH_SIZE / 2;
+	int pixel0Y = smallPatchY - PATCH_SIZE / 2 + top;
+	int pixel0 = pixel0X + stride0 * pixel0Y;
+	const TS *r0 = &small.red[pixel0];
+	const TS *g0 = &small.green[pixel0];
+	const TS *b0 = &small.blue[pixel0];
+
+	int stride1 = large->w();
+	int pixel1X = largePatchX - PATCH_SIZE / 2;
+	int pixel1Y = largePatchY - PATCH_SIZE / 2 + top;
+	int pixel1 = pixel1X + stride1 * pixel1Y;
+	TL *r1 = &large->red[pixel1];
+	TL *g1 = &large->green[pixel1];
+	TL *b1 = &large->blue[pixel1];
+
+	for (int j = top; j < bottom; j++) {
+		for (int i = 0; i < PATCH_SIZE; i++) {
+			*r1 = (TL)(*r1 + *r0);
+			*g1 = (TL)(*g1 + *g0);
+			*b1 = (TL)(*b1 + *b0);
+
+			r0++; g0++; b0++;
+			r1++; g1++; b1++;
+		}
+
+		r0 += stride0 - PATCH_SIZE;
+		g0 += stride0 - PATCH_SIZE;
+		b0 += stride0 - PATCH_SIZE;
+		r1 += stride1 - PATCH_SIZE;
+		g1 += stride1 - PATCH_SIZE;
+		b1 += stride1 - PATCH_SIZE;
+	}
+}
+
+Err ScalerSelfSim2x::scale2x(const ConstImageView &src, Image *dst) {
+	Err e = Err::Success;
+
+	// First, split input image into low and high frequency sub-imags
+	Image tmp1, tmp2, low, high;
+
+	// low-freq is downscaled and then upscaled again
+	e = scaleLinear(src, src.w() / 2, src.h() / 2, &tmp1); ree;
+	e = scaleLinear(tmp1, src.w(), src.h(), &low); ree;
+
+	// Break to channels to process easily. Components fit in 8 bits and the
+	// high-frequency residuals (and 25 of them summed) in 16 bits.
+	ImageChannels8 srcC(src);
+	ImageChannels8 lowC(low);
+	ImageChannels16 highC(srcC - lowC);
+
+	// Now, upsample. This will produce a larger but blurry picture
+	// (Picture with only lower part of the frequency band).
+	Image largeLow;
+	e = scaleLinear(src, src.w() * 2, src.h() * 2, &largeLow); ree;
+	ImageChannels8 largeLowC(largeLow);
+
+	// Create an empty image (black) upon which we will paste the hi-freq patches (additive paste)
+	ImageChannels16 largeHighC(largeLowC.w(), largeLowC.h());
+
+	// match each one of the possible 5x5 patches into the blurred version of the small picture
+	ScratchArena scratch;
+	int largeW = largeLowC.w();
+	int largeH = largeLowC.h();
+	PatchOffset *best = scratch.alloc<PatchOffset>((size_t)largeW * largeH);
+	PatchOffset none = { NO_PATCH, 0 };
+	std::fill_n(best, (size_t)largeW * largeH, none);
+
+	// the half-size luma planes of the hierarchical search
+	uint8_t *coarseSmall = nullptr;
+	uint8_t *coarseLarge = nullptr;
+	if (mSearch == Search::Hierarchical) {
+		coarseSmall = scratch.alloc<uint8_t>((size_t)(srcC.w() / 2) * (srcC.h() / 2));
+		coarseLarge = scratch.alloc<uint8_t>((size_t)(largeW / 2) * (largeH / 2));
+		decimateLuma(srcC, coarseSmall);
+		decimateLuma(largeLowC, coarseLarge);
+	}
+
+	// Output pixels are matched independently, so bands of rows can be matched in any order
+	int bands = (largeH + BAND_ROWS - 1) / BAND_ROWS;
+	ThreadPool::instance().parallelFor(bands, threads(), [&](int k) {
+		int rowBegin = k * BAND_ROWS;
+		int rowEnd = std::min(largeH, rowBegin + BAND_ROWS);
+
+		if (mSearch == Search::AllOffsets) {
+			ScratchArena bandScratch;
+			matchAllOffsets(srcC, largeLowC, rowBegin, rowEnd, bandScratch, best);
+		} else if (mSearch == Search::PatchMatch) {
+			ScratchArena bandScratch;
+			matchPatchMatch(srcC, largeLowC, rowBegin, rowEnd, mPatchMatchRadius, mPatchMatchIterations, bandScratch, best);
+		} else if (mSearch == Search::Hierarchical) {
+			ScratchArena bandScratch;
+			matchHierarchical(srcC, largeLowC, coarseSmall, coarseLarge, rowBegin, rowEnd, mCoarseRadius, mRefineRadius,
+				bandScratch, best);
+		} else {
+			matchExhaustive(srcC, largeLowC, rowBegin, rowEnd, best);
+		}
+	});
+
+	// Patches overlap, so rather than pasting each patch whole, every band gathers the rows
+	// it owns of all the patches reaching into it. No two threads write the same pixel, and
+	// each pixel receives the same contributions as when pasting patch by patch.
+	ThreadPool::instance().parallelFor(bands, threads(), [&](int k) {
+		int rowBegin = k * BAND_ROWS;
+		int rowEnd = std::min(largeH, rowBegin + BAND_ROWS);
+
+		int jBegin = std::max(PATCH_SIZE / 2, rowBegin - PATCH_SIZE / 2);
+		int jEnd = std::min(largeH - PATCH_SIZE, rowEnd + PATCH_SIZE / 2);
+
+		for (int i = PATCH_SIZE / 2; i < largeW - PATCH_SIZE; i++) {
+
+			for (int j = jBegin; j < jEnd; j++) {
+				PatchOffset offset = best[i + largeW * j];
+				if (offset.x == NO_PATCH) {
+					continue;
+				}
+
+				int bestX = i / 2 + offset.x;
+				int bestY = j / 2 + offset.y;
+
+				// additively paste the part of the hi-freq patch inside the band
+				applyPatch(highC, bestX, bestY, &largeHighC, i, j, rowBegin, rowEnd);
+			}
+		}
+	});
+
+	// Every pixel in the high freq image has now received the contribution of 5x5 incoming patches.
+	// Average, merge with the low frequency band and write the output, all in one pass.
+	dst->setSizeDiscard(largeLowC.w(), largeLowC.h());
+	packChannels(largeLowC + largeHighC / (PATCH_SIZE * PATCH_SIZE), ImageView(*dst));
+
+	return e;
+}
+
+int ScalerSelfSim2x::threads() const {
+	return mThreadCount > 0 ? mThreadCount : ThreadPool::instance().threadCount();
+}
+
@@ -1,36 +1,115 @@
-/*
-* Copyright(c) 2018 Michael Georgoulopoulos
-*
-* Permission is hereby granted, free of charge, to any person obtaining a copy
-* of this software and associated documentation files(the "Software"), to deal
-* in the Software without restriction, including without limitation the rights
-* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-* copies of the Software, and to permit persons to whom the Software is
-* furnished to do so, subject to the following conditions :
-*
-* The above copyright notice and this permission notice shall be included in all
-* copies or substantial portions of the Software.
-*
-* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-* SOFTWARE.
-*/
-
-#ifndef __SCALER_SELF_SIM_H__
-#define __SCALER_SELF_SIM_H__
-
-#include "Scaler2x.h"
-
-class ScalerSelfSim2x : public Scaler2x {
-public:
-	ScalerSelfSim2x();
-	virtual ~ScalerSelfSim2x();	
-private:
-	Err scale2x(const Image &src, Image *dst) override;
-};
-
+/*
+* Copyright(c) 2018 Michael Georgoulopoulos
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#ifndef __SCALER_SELF_SIM_H__
+#define __SCALER_SELF_SIM_H__
+
+#include "Scaler2x.h"
+
+class ScalerSelfSim2x : public Scaler2x {
+public:
+	ScalerSelfSim2x();
+	virtual ~ScalerSelfSim2x();	
+
+	/*!
+	\brief How the best matching low-resolution patch is found for every output pixel.
+	Exhaustive and AllOffsets give the same result; PatchMatch and Hierarchical are approximate.
+	*/
+	enum class Search {
+		// every candidate patch is compared from scratch
+		Exhaustive,
+		// difference images per offset, shared by neighbouring pixels through running box sums
+		AllOffsets,
+		// randomised propagation of good matches between neighbours; see setPatchMatchRadius()
+		PatchMatch,
+		// a luma-only search at half size, refined in colour around its matches; see setCoarseRadius()
+		Hierarchical,
+	};
+
+	void setSearch(Search search) { mSearch = search; }
+	Search search() const { return mSearch; }
+
+	/*!
+	\brief Rounds of propagation and random search of Search::PatchMatch.
+	More rounds get closer to the exhaustive result, each costing about as much as the first.
+	*/
+	void setPatchMatchIterations(int iterations) { mPatchMatchIterations = std::max(1, iterations); }
+	int patchMatchIterations() const { return mPatchMatchIterations; }
+
+	/*!
+	\brief How far, in source pixels, Search::PatchMatch looks from an output pixel's
+	position in the source, up to 127. The other methods use 3; unlike theirs,
+	the cost of PatchMatch grows only with the logarithm of the radius.
+	*/
+	void setPatchMatchRadius(int radius) { mPatchMatchRadius = std::max(1, std::min(127, radius)); }
+	int patchMatchRadius() const { return mPatchMatchRadius; }
+
+	/*!
+	\brief How far, in half-size source pixels, the first pass of Search::Hierarchical looks,
+	up to 56. It covers twice that in source pixels, at a twelfth of the cost per candidate
+	of a full-size search.
+	*/
+	void setCoarseRadius(int radius) { mCoarseRadius = std::max(1, std::min(56, radius)); }
+	int coarseRadius() const { return mCoarseRadius; }
+
+	/*!
+	\brief How far, in source pixels, Search::Hierarchical looks around an output pixel's
+	position and around the match of its first pass, up to 8: (2 * radius + 1)^2
+	candidates each.
+	*/
+	void setRefineRadius(int radius) { mRefineRadius = std::max(1, std::min(8, radius)); }
+	int refineRadius() const { return mRefineRadius; }
+
+	/*!
+	\brief Threads a scale may use, the calling one included; 0 means one per hardware thread.
+	Patches are matched and pasted a band of output rows at a time, and the result
+	does not depend on how many threads there are.
+	*/
+	void setThreadCount(int threadCount) { mThreadCount = std::max(0, threadCount); }
+	int threadCount() const { return mThreadCount; }
+
+protected:
+	// Covers the patch search window of Exhaustive and AllOffsets and the low-pass filter
+	int fusedHalo() const override { return 16; }
+
+	// The low-pass step halves the input, so an odd-sized source would put tiles
+	// on a different resampling grid than the full image. PatchMatch and
+	// Hierarchical look further than the halo.
+	bool fusable(const ConstImageView &src) const override;
+
+private:
+	Err scale2x(const ConstImageView &src, Image *dst) override;
+	int threads() const;
+
+	// Default tile size of the fused cascade, in source pixels
+	static const int FUSED_TILE_SIZE = 512;
+
+private:
+	Search mSearch;
+	int mPatchMatchIterations;
+	int mPatchMatchRadius;
+	int mCoarseRadius;
+	int mRefineRadius;
+	int mThreadCount;
+};
+
 #endif // ndef __SCALER_H__
\ No newline at end of file